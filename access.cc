@@ -46,7 +46,7 @@ void bltinAccess::encode(action act, position pos, coder &e)
       bltinError(pos);
       break;
     case CALL:
-      e.encode(inst::builtin, f);
+      e.encodeBuiltin(f);
       break;
   }
 }
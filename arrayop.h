@@ -25,6 +25,98 @@ using camp::tab;
 vm::array *copyArray(vm::array *a);
 vm::array *copyArray2(vm::array *a);
 
+// Elementwise operations that can never raise an error and hence may be
+// applied directly to the unboxed values of compact items.
+template<class T, template <class S> class op>
+struct unboxedOp {
+  static const bool value=false;
+};
+
+#if COMPACT
+template<>
+struct unboxedOp<double,plus> {
+  static const bool value=true;
+};
+
+template<>
+struct unboxedOp<double,minus> {
+  static const bool value=true;
+};
+
+template<>
+struct unboxedOp<double,times> {
+  static const bool value=true;
+};
+
+// Return true if no element of a is empty.
+inline bool unboxed(const array *a, size_t size)
+{
+  const vm::item *A=a->data();
+  bool empty=false;
+  for(size_t i=0; i < size; ++i)
+    empty |= A[i].empty();
+  return !empty;
+}
+#endif
+
+// Vectorizable kernels for elementwise array operations. Each returns false
+// if the operation must instead be done item by item, with full checking.
+template<class T, template <class S> class op,
+         bool Unboxed=unboxedOp<T,op>::value>
+struct kernel {
+  template<class U>
+  static bool arrayOp(const array *, U, array *, size_t) {return false;}
+  template<class U>
+  static bool opArray(U, const array *, array *, size_t) {return false;}
+  static bool arrayArrayOp(const array *, const array *, array *, size_t) {
+    return false;
+  }
+};
+
+#if COMPACT
+template<class T, template <class S> class op>
+struct kernel<T,op,true> {
+  static bool arrayOp(const array *a, T b, array *c, size_t size) {
+    if(!unboxed(a,size)) return false;
+    const vm::item *A=a->data();
+    vm::item *C=c->data();
+    for(size_t i=0; i < size; ++i)
+      C[i]=op<T>()(vm::unboxed<T>(A[i]),b);
+    return true;
+  }
+
+  static bool opArray(T b, const array *a, array *c, size_t size) {
+    if(!unboxed(a,size)) return false;
+    const vm::item *A=a->data();
+    vm::item *C=c->data();
+    for(size_t i=0; i < size; ++i)
+      C[i]=op<T>()(b,vm::unboxed<T>(A[i]));
+    return true;
+  }
+
+  static bool arrayArrayOp(const array *a, const array *b, array *c,
+                           size_t size) {
+    if(!unboxed(a,size) || !unboxed(b,size)) return false;
+    const vm::item *A=a->data();
+    const vm::item *B=b->data();
+    vm::item *C=c->data();
+    for(size_t i=0; i < size; ++i)
+      C[i]=op<T>()(vm::unboxed<T>(A[i]),vm::unboxed<T>(B[i]));
+    return true;
+  }
+};
+#endif
+
+// Store op(a[i],b) in c[i]; c may be a.
+template<class T, class U, template <class S> class op>
+void arrayOp(array *c, const array *a, U b, size_t size)
+{
+  if(!kernel<T,op>::arrayOp(a,b,c,size)) {
+    for(size_t i=0; i < size; i++)
+      (*c)[i]=op<T>()(read<T>(a,i),b,i);
+  }
+}
+
 template<class T, class U, template <class S> class op>
 void arrayOp(vm::stack *s)
 {
@@ -32,11 +124,20 @@ void arrayOp(vm::stack *s)
   array *a=pop<array*>(s);
   size_t size=checkArray(a);
   array *c=new array(size);
-  for(size_t i=0; i < size; i++)
-    (*c)[i]=op<T>()(read<T>(a,i),b,i);
+  arrayOp<T,U,op>(c,a,b,size);
   s->push(c);
 }
 
+// Store op(b,a[i]) in c[i]; c may be a.
+template<class T, class U, template <class S> class op>
+void opArray(array *c, T b, const array *a, size_t size)
+{
+  if(!kernel<U,op>::opArray(b,a,c,size)) {
+    for(size_t i=0; i < size; i++)
+      (*c)[i]=op<U>()(b,read<U>(a,i),i);
+  }
+}
+
 template<class T, class U, template <class S> class op>
 void opArray(vm::stack *s)
 {
@@ -44,11 +145,20 @@ void opArray(vm::stack *s)
   T b=pop<T>(s);
   size_t size=checkArray(a);
   array *c=new array(size);
-  for(size_t i=0; i < size; i++)
-    (*c)[i]=op<U>()(b,read<U>(a,i),i);
+  opArray<T,U,op>(c,b,a,size);
   s->push(c);
 }
 
+// Store op(a[i],b[i]) in c[i]; c may be a or b.
+template<class T, template <class S> class op>
+void arrayArrayOp(array *c, const array *a, const array *b, size_t size)
+{
+  if(!kernel<T,op>::arrayArrayOp(a,b,c,size)) {
+    for(size_t i=0; i < size; i++)
+      (*c)[i]=op<T>()(read<T>(a,i),read<T>(b,i),i);
+  }
+}
+
 template<class T, template <class S> class op>
 void arrayArrayOp(vm::stack *s)
 {
@@ -56,8 +166,40 @@ void arrayArrayOp(vm::stack *s)
   array *a=pop<array*>(s);
   size_t size=checkArrays(a,b);
   array *c=new array(size);
-  for(size_t i=0; i < size; i++)
-    (*c)[i]=op<T>()(read<T>(a,i),read<T>(b,i),i);
+  arrayArrayOp<T,op>(c,a,b,size);
+  s->push(c);
+}
+
+// Variants of the above that overwrite an array argument which the
+// translator has determined to be an unreferenced temporary, to avoid
+// allocating a new array for each operation in an expression
+// (see coder::encodeBuiltin).
+template<class T, class U, template <class S> class op>
+void arrayOpInPlace(vm::stack *s)
+{
+  U b=pop<U>(s);
+  array *a=pop<array*>(s);
+  arrayOp<T,U,op>(a,a,b,checkArray(a));
+  s->push(a);
+}
+
+template<class T, class U, template <class S> class op>
+void opArrayInPlace(vm::stack *s)
+{
+  array *a=pop<array*>(s);
+  T b=pop<T>(s);
+  opArray<T,U,op>(a,b,a,checkArray(a));
+  s->push(a);
+}
+
+// Overwrite the argument at the given stack depth: 0 for b, 1 for a.
+template<class T, template <class S> class op, size_t depth>
+void arrayArrayOpInPlace(vm::stack *s)
+{
+  array *b=pop<array*>(s);
+  array *a=pop<array*>(s);
+  array *c=depth == 0 ? b : a;
+  arrayArrayOp<T,op>(c,a,b,checkArrays(a,b));
   s->push(c);
 }
 
@@ -487,6 +629,16 @@ void arrayFunc(vm::stack *s)
   s->push(c);
 }
 
+template <class T, class S, T (*func)(S)>
+void arrayFuncInPlace(vm::stack *s)
+{
+  array *a=pop<array*>(s);
+  size_t size=checkArray(a);
+  for(size_t i=0; i < size; i++)
+    (*a)[i]=func(read<S>(a,i));
+  s->push(a);
+}
+
 template <class T, class S, T (*func)(S)>
 void arrayFunc2(vm::stack *s)
 {
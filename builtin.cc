@@ -151,7 +151,6 @@ void addFunc(venv &ve, bltin f, ty *result, symbol name,
              formal f7, formal f8, formal f9, formal fA, formal fB, formal fC,
              formal fD, formal fE, formal fF, formal fG, formal fH, formal fI)
 {
-#ifdef DEBUG_BLTIN
   // If the function is an operator, print out the whole signature with the
   // types, as operators are heavily overloaded.  min and max are also heavily
   // overloaded, so we check for them too.  Many builtin functions have so
@@ -168,7 +167,6 @@ void addFunc(venv &ve, bltin f, ty *result, symbol name,
   else {
     REGISTER_BLTIN(f, name);
   }
-#endif
 
   access *a = new bltinAccess(f);
   addFunc(ve,a,result,name,f1,f2,f3,f4,f5,f6,f7,f8,f9,
@@ -215,6 +213,28 @@ void addRestFunc(venv &ve, bltin f, ty *result, symbol name, formal frest,
   ve.enter(name, ent);
 }
 
+// Register a variant of a builtin that reuses a temporary array argument.
+void addInPlace(bltin f, bltin variant, size_t depth)
+{
+  REGISTER_BLTIN(variant, lookupBltin(f)+" in place");
+  registerInPlace(f,variant,depth);
+}
+
+template<class T, class S, T (*func)(S)>
+void addArrayFuncInPlace()
+{
+  addInPlace(arrayFunc<T,S,func>,arrayFuncInPlace<T,S,func>,0);
+}
+
+template<class T, template <class S> class op>
+void addArrayOpsInPlace()
+{
+  addInPlace(opArray<T,T,op>,opArrayInPlace<T,T,op>,0);
+  addInPlace(arrayOp<T,T,op>,arrayOpInPlace<T,T,op>,1);
+  addInPlace(arrayArrayOp<T,op>,arrayArrayOpInPlace<T,op,0>,0);
+  addInPlace(arrayArrayOp<T,op>,arrayArrayOpInPlace<T,op,1>,1);
+}
+
 void addRealFunc0(venv &ve, bltin fcn, symbol name)
 {
   addFunc(ve, fcn, primReal(), name);
@@ -226,6 +246,7 @@ void addRealFunc(venv &ve, symbol name)
   addFunc(ve, realReal<fcn>, primReal(), name, formal(primReal(),SYM(x)));
   addFunc(ve, arrayFunc<double,double,fcn>, realArray(), name,
           formal(realArray(),SYM(a)));
+  addArrayFuncInPlace<double,double,fcn>();
 }
 
 #define addRealFunc(fcn, sym) addRealFunc<fcn>(ve, sym);
@@ -257,11 +278,9 @@ void addInitializer(venv &ve, ty *t, access *a)
 
 void addInitializer(venv &ve, ty *t, bltin f)
 {
-#ifdef DEBUG_BLTIN
   ostringstream s;
   s << "initializer for " << *t;
   REGISTER_BLTIN(f, s.str());
-#endif
   access *a = new bltinAccess(f);
   addInitializer(ve, t, a);
 }
@@ -280,20 +299,16 @@ void addCast(venv &ve, ty *target, ty *source, access *a) {
 }
 
 void addExplicitCast(venv &ve, ty *target, ty *source, bltin f) {
-#ifdef DEBUG_BLTIN
   ostringstream s;
   s << "explicit cast from " << *source << " to " << *target;
   REGISTER_BLTIN(f, s.str());
-#endif
   addExplicitCast(ve, target, source, new bltinAccess(f));
 }
 
 void addCast(venv &ve, ty *target, ty *source, bltin f) {
-#ifdef DEBUG_BLTIN
   ostringstream s;
   s << "cast from " << *source << " to " << *target;
   REGISTER_BLTIN(f, s.str());
-#endif
   addCast(ve, target, source, new bltinAccess(f));
 }
 
@@ -456,6 +471,7 @@ void addOps(venv &ve, ty *t1, symbol name, ty *t2)
   addFunc(ve,opArray<T,T,op>,t2,name,formal(t1,SYM(a)),formal(t2,SYM(b)));
   addFunc(ve,arrayOp<T,T,op>,t2,name,formal(t2,SYM(a)),formal(t1,SYM(b)));
   addSimpleOperator(ve,arrayArrayOp<T,op>,t2,name);
+  addArrayOpsInPlace<T,op>();
 }
 
 template<class T, template <class S> class op>
@@ -468,6 +484,7 @@ void addBooleanOps(venv &ve, ty *t1, symbol name, ty *t2)
           booleanArray(),name,formal(t2,SYM(a)),formal(t1,SYM(b)));
   addFunc(ve,arrayArrayOp<T,op>,booleanArray(),name,formal(t2,SYM(a)),
           formal(t2,SYM(b)));
+  addArrayOpsInPlace<T,op>();
 }
 
 void addWrite(venv &ve, bltin f, ty *t1, ty *t2)
@@ -566,6 +583,7 @@ void addBasicOps(venv &ve, ty *t1, ty *t2, ty *t3, ty *t4, bool integer=false,
   addFunc(ve,&id,t2,SYM_PLUS,formal(t2,SYM(a)));
   addFunc(ve,Negate<T>,t1,SYM_MINUS,formal(t1,SYM(a)));
   addFunc(ve,arrayFunc<T,T,negate>,t2,SYM_MINUS,formal(t2,SYM(a)));
+  addArrayFuncInPlace<T,T,negate>();
   addFunc(ve,arrayFunc2<T,T,negate>,t3,SYM_MINUS,formal(t3,SYM(a)));
   if(!integer) addFunc(ve,interp<T>,t1,SYM(interp),
                        formal(t1,SYM(a),false,Explicit),
@@ -719,11 +737,14 @@ void addOperators(venv &ve)
 
   addFunc(ve,arrayFunc<double,pair,abs>,realArray(),SYM(abs),
           formal(pairArray(),SYM(a)));
+  addArrayFuncInPlace<double,pair,abs>();
   addFunc(ve,arrayFunc<double,triple,abs>,realArray(),SYM(abs),
           formal(tripleArray(),SYM(a)));
+  addArrayFuncInPlace<double,triple,abs>();
 
   addFunc(ve,arrayFunc<pair,pair,conjugate>,pairArray(),SYM(conj),
           formal(pairArray(),SYM(a)));
+  addArrayFuncInPlace<pair,pair,conjugate>();
   addFunc(ve,arrayFunc2<pair,pair,conjugate>,pairArray2(),SYM(conj),
           formal(pairArray2(),SYM(a)));
 
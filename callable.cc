@@ -44,10 +44,7 @@ bool bfunc::compare(callable* F)
 }
 
 void bfunc::print(ostream& out) {
-  out << "bltin";
-#ifdef DEBUG_BLTIN
-  out << " " << lookupBltin(func);
-#endif
+  out << "bltin " << lookupBltin(func);
 }
 
 void thunk::call(stack *s)
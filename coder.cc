@@ -161,6 +161,43 @@ void coder::encodePop()
   }
 }
 
+// Returns true if the instruction at p pushes a single value onto the stack
+// without otherwise affecting it.
+inline bool simplePush(vm::program::label p)
+{
+  return p->op == inst::constpush || p->op == inst::intpush ||
+    p->op == inst::varpush;
+}
+
+void coder::encodeBuiltin(vm::bltin f)
+{
+  if (isStatic() && !isTopLevel()) {
+    assert(parent);
+    parent->encodeBuiltin(f);
+    return;
+  }
+
+  // Look for the result of a builtin that is on top of the stack or just
+  // below a single pushed value, with no label in between.
+  vm::program::label p = program->end();
+  for (size_t depth = 0; depth < 2 && p != program->begin(); ++depth) {
+    --p;
+    if (lastLabel.defined() && offset(lastLabel, p) < 0)
+      break;
+    if (p->op == inst::builtin) {
+      if (vm::returnsTemporary(vm::get<vm::bltin>(*p))) {
+        vm::bltin variant = vm::lookupInPlace(f, depth);
+        if (variant)
+          f = variant;
+      }
+      break;
+    }
+    if (!simplePush(p))
+      break;
+  }
+
+  encode(inst::builtin, f);
+}
 
 bool coder::encode(frame *f)
 {
@@ -243,6 +280,7 @@ label coder::defLabel(label label)
   //vm::program::label here = program->end();
   label->location = program->end();
   assert(label->location.defined());
+  lastLabel = label->location;
 
   if (label->firstUse.defined()) {
     replaceEmptyJump(label->firstUse, program->end());
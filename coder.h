@@ -104,6 +104,10 @@ class coder {
   // pushframe instructions are, so the size of the frame can be encoded.
   std::stack<vm::program::label> pushframeLabels;
 
+  // The location of the most recently defined label.  As control may jump
+  // there, instructions before it are not combined with those after it.
+  vm::program::label lastLabel;
+
   // Loops need to store labels to where break and continue statements
   // should pass control.  Since loops can be nested, this needs to
   // be stored as a stack.  We also store which of the loops are being encoded
@@ -299,6 +303,11 @@ public:
   // instruction (ex. varsave+pop becomes varpop).
   void encodePop();
 
+  // Encodes a call to a builtin function, substituting a variant that
+  // reuses an array argument if that argument is the temporary result of
+  // the preceding builtin (ex. the sum in sqrt(x+y) is overwritten by sqrt).
+  void encodeBuiltin(vm::bltin f);
+
   // Puts the requested frame on the stack.  If the frame is not that of
   // this coder or its ancestors, false is returned.
   bool encode(frame *f);
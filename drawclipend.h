@@ -37,6 +37,8 @@ public:
 
   bool svg() {return true;}
 
+  bool nativepdf() {return true;}
+
   void save(bool b) {
     grestore=b;
     if(partner) partner->save(b);
@@ -211,6 +211,9 @@ public:
 // Implement SVG element as png image?
   virtual bool svgpng() {return false;}
 
+// Can element be written directly to a PDF file?
+  virtual bool nativepdf() {return false;}
+
   virtual bool beginclip() {return false;}
   virtual bool endclip() {return false;}
 
@@ -32,6 +32,8 @@ public:
   // dvisvgm doesn't yet support SVG patterns.
   bool svgpng() {return pentype.fillpattern() != "";}
 
+  bool nativepdf() {return !stroke && pentype.fillpattern() == "";}
+
   virtual ~drawFill() {}
 
   virtual bool draw(psfile *out);
@@ -241,6 +243,8 @@ public:
 
   virtual ~drawFunctionShade() {}
 
+  bool nativepdf() {return false;}
+
   bool draw(psfile *out) {return false;}
 
   bool write(texfile *, const bbox&);
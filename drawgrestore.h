@@ -17,6 +17,8 @@ public:
   drawGrestore() {}
   virtual ~drawGrestore() {}
 
+  bool nativepdf() {return true;}
+
   bool draw(psfile *out) {
     out->grestore();
     return true;
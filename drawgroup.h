@@ -19,6 +19,8 @@ public:
   virtual ~drawBegin() {}
 
   bool begingroup() {return true;}
+
+  bool nativepdf() {return true;}
 };
 
 class drawEnd : public drawElement {
@@ -28,6 +30,8 @@ public:
   virtual ~drawEnd() {}
 
   bool endgroup() {return true;}
+
+  bool nativepdf() {return true;}
 };
 
 class drawBegin3 : public drawElementLC {
@@ -17,6 +17,8 @@ public:
   drawGsave() {}
   virtual ~drawGsave() {}
 
+  bool nativepdf() {return true;}
+
   bool draw(psfile *out) {
     out->gsave();
     return true;
@@ -30,6 +30,8 @@ public:
 
   bool svg() {return true;}
   bool svgpng() {return true;}
+
+  bool nativepdf() {return true;}
 };
 
 class drawPaletteImage : public drawImage {
@@ -8,9 +8,11 @@
 #include <sstream>
 
 #include "drawlabel.h"
+#include "picture.h"
 #include "settings.h"
 #include "util.h"
 #include "lexical.h"
+#include "timing.h"
 
 using namespace settings;
 
@@ -57,6 +59,7 @@ void texdim(iopipestream& tex, double& dest, const string command,
 void texbounds(double& width, double& height, double& depth,
                iopipestream& tex, string& s)
 {
+  waitShipoutsReadBy(s);
   tex << "\\setbox\\ASYbox=\\hbox{" << stripblanklines(s) << "}\n\n";
   tex.wait(texready.c_str());
   texdim(tex,width,"wd","width");
@@ -91,6 +94,8 @@ void drawLabel::getbounds(iopipestream& tex, const string& texengine)
   if(havebounds) return;
   havebounds=true;
 
+  timing::timer timer(timing::LABELS);
+
   setpen(tex,texengine,pentype);
   texbounds(width,height,depth,tex,label);
 
@@ -188,6 +193,7 @@ bool drawLabel::write(texfile *out, const bbox&)
 {
   checkbounds();
   if(suppress || pentype.invisible() || !enabled) return true;
+  waitShipoutsReadBy(label);
   out->setpen(pentype);
   out->put(label,T,position,texAlign);
   return true;
@@ -246,6 +252,7 @@ bool drawLabelPath::write(texfile *out, const bbox&)
 
   checkbounds();
   if(drawLabel::pentype.invisible()) return true;
+  waitShipoutsReadBy(label);
   out->setpen(drawLabel::pentype);
   out->verbatimline("\\psset{unit=1pt}%");
   out->verbatim("\\pstextpath[");
@@ -19,6 +19,8 @@ public:
   virtual ~drawLayer() {}
 
   bool islayer() {return true;}
+
+  bool nativepdf() {return true;}
 };
 
 class drawNewPage : public drawLayer {
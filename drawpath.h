@@ -26,6 +26,12 @@ public:
 
   bool svg() {return true;}
 
+  // PDF cannot transform the pen after the path is constructed.
+  bool nativepdf() {
+    return pentype.fillpattern() == "" &&
+      shiftless(pentype.getTransform()).isIdentity();
+  }
+
   bool draw(psfile *out);
 
   drawElement *transformed(const transform& t);
@@ -32,7 +32,7 @@ public:
     return lineNum;
   }
 
-  string name() const {
+  const string& name() const {
     return filename;
   }
 
@@ -86,6 +86,11 @@ public:
     return file ? file->name() : "";
   }
 
+  const fileinfo *File() const
+  {
+    return file;
+  }
+
   size_t Line() const
   {
     return line;
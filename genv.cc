@@ -23,6 +23,7 @@
 #include "stm.h"
 #include "types.h"
 #include "settings.h"
+#include "timing.h"
 #include "runtime.h"
 #include "parser.h"
 #include "locate.h"
@@ -72,6 +73,8 @@ record *genv::loadModule(symbol id, string filename) {
   }
 #endif
 
+  timing::timer timer(timing::TRANSLATE);
+
   // Get the abstract syntax tree.
   absyntax::file *ast = parser::parseFile(filename,"Loading");
 
@@ -0,0 +1,146 @@
+/*****
+ * ghostscript.cc
+ *
+ * Run Ghostscript conversions, in-process through libgs when available.
+ *****/
+
+#include "ghostscript.h"
+#include "settings.h"
+#include "util.h"
+#include "seconds.h"
+#include "timing.h"
+
+#ifdef HAVE_DLFCN_H
+#include <dlfcn.h>
+#endif
+
+using settings::getSetting;
+using settings::verbose;
+
+namespace camp {
+
+#ifdef HAVE_DLFCN_H
+
+namespace {
+
+// The subset of the Ghostscript interface (iapi.h) used here.
+const int GS_ARG_ENCODING_UTF8=1;
+const int gs_error_Quit=-101;
+
+typedef int (*gsapi_new_instance_t)(void **, void *);
+typedef void (*gsapi_delete_instance_t)(void *);
+typedef int (*gsapi_set_arg_encoding_t)(void *, int);
+typedef int (*gsapi_init_with_args_t)(void *, int, char **);
+typedef int (*gsapi_exit_t)(void *);
+
+struct gsapi {
+  void *handle;
+  gsapi_new_instance_t new_instance;
+  gsapi_delete_instance_t delete_instance;
+  gsapi_set_arg_encoding_t set_arg_encoding;
+  gsapi_init_with_args_t init_with_args;
+  gsapi_exit_t exit;
+
+  gsapi() : handle(NULL) {}
+
+  bool load(const string& name) {
+    handle=dlopen(name.c_str(),RTLD_NOW | RTLD_LOCAL);
+    if(!handle) return false;
+    new_instance=(gsapi_new_instance_t) dlsym(handle,"gsapi_new_instance");
+    delete_instance=
+      (gsapi_delete_instance_t) dlsym(handle,"gsapi_delete_instance");
+    set_arg_encoding=
+      (gsapi_set_arg_encoding_t) dlsym(handle,"gsapi_set_arg_encoding");
+    init_with_args=
+      (gsapi_init_with_args_t) dlsym(handle,"gsapi_init_with_args");
+    exit=(gsapi_exit_t) dlsym(handle,"gsapi_exit");
+    if(new_instance && delete_instance && init_with_args && exit)
+      return true;
+    dlclose(handle);
+    handle=NULL;
+    return false;
+  }
+};
+
+// Load the Ghostscript library on first use and keep it for the rest of the
+// run, so that later conversions (and later jobs in interactive mode) skip
+// the dynamic linking and relocation of libgs.
+gsapi *library()
+{
+  static bool tried=false;
+  static gsapi lib;
+  if(!tried) {
+    tried=true;
+    double start=utils::totalseconds();
+    string libgs=getSetting<string>("libgs");
+    if(!libgs.empty())
+      lib.load(libgs);
+    else {
+      const char *names[]={"libgs.so","libgs.so.10","libgs.so.9",
+                           "libgs.dylib"};
+      for(size_t i=0; i < sizeof(names)/sizeof(char *); ++i)
+        if(lib.load(names[i])) break;
+    }
+    if(verbose > 1) {
+      if(lib.handle)
+        cout << "Loaded Ghostscript library in "
+             << utils::totalseconds()-start << "s" << endl;
+      else
+        cout << "Cannot load Ghostscript library; using "
+             << getSetting<string>("gs") << endl;
+    }
+  }
+  return lib.handle ? &lib : NULL;
+}
+
+// Run one conversion on a fresh instance: Ghostscript reads its device
+// parameters from the command line only during initialization.
+int run(gsapi *gs, const mem::vector<string>& cmd)
+{
+  void *instance;
+  if(gs->new_instance(&instance,NULL) < 0) return -1;
+  if(gs->set_arg_encoding)
+    gs->set_arg_encoding(instance,GS_ARG_ENCODING_UTF8);
+
+  size_t n=cmd.size();
+  mem::vector<char *> argv(n+1);
+  for(size_t i=0; i < n; ++i)
+    argv[i]=const_cast<char *>(cmd[i].c_str());
+  argv[n]=NULL;
+
+  int code=gs->init_with_args(instance,(int) n,&argv[0]);
+  int code1=gs->exit(instance);
+  if(code == 0 || code == gs_error_Quit) code=code1;
+  gs->delete_instance(instance);
+  return code == 0 || code == gs_error_Quit ? 0 : 1;
+}
+
+}
+
+#endif
+
+int Ghostscript(const mem::vector<string>& cmd, const char *hint,
+                const char *application)
+{
+  double start=verbose > 1 ? utils::totalseconds() : 0.0;
+  int status;
+  const char *mode="process";
+  timing::count(timing::GSCALLS);
+#ifdef HAVE_DLFCN_H
+  gsapi *gs=getSetting<bool>("gsapi") ? library() : NULL;
+  if(gs) {
+    cout.flush();
+    timing::timer timer(timing::EXTERNAL);
+    status=run(gs,cmd);
+    mode="library";
+  } else
+#endif
+    status=System(cmd,0,true,hint,application);
+
+  if(verbose > 1)
+    cout << "Ghostscript " << mode << " call took "
+         << utils::totalseconds()-start << "s" << endl;
+  return status;
+}
+
+} //namespace camp
@@ -0,0 +1,23 @@
+/*****
+ * ghostscript.h
+ *
+ * Run Ghostscript conversions, in-process through libgs when available.
+ *****/
+
+#ifndef GHOSTSCRIPT_H
+#define GHOSTSCRIPT_H
+
+#include "common.h"
+
+namespace camp {
+
+// Run the Ghostscript command line cmd (whose first entry names the gs
+// executable) and return its exit status. If the gsapi setting is enabled
+// and the library named by the libgs setting can be loaded, the conversion
+// runs inside this process; otherwise gs is executed as with System().
+int Ghostscript(const mem::vector<string>& cmd, const char *hint="gs",
+                const char *application="Ghostscript");
+
+} //namespace camp
+
+#endif
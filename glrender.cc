@@ -25,6 +25,7 @@
 #include "drawimage.h"
 #include "interact.h"
 #include "fpu.h"
+#include "timing.h"
 
 namespace gl {
 #ifdef HAVE_PTHREAD
@@ -502,6 +503,8 @@ void drawscene(int Width, int Height)
   }
 #endif
 
+  timing::timer timer(timing::RENDER);
+
   if((nlights == 0 && Nlights > 0) || nlights > Nlights ||
      nmaterials > Nmaterials) {
     deleteShaders();
@@ -1970,6 +1973,8 @@ void drawBuffer(vertexBuffer& data, GLint shader)
     (normal ? sizeof(vertexData) : sizeof(vertexData0));
 
   bool copy=gl::remesh || data.partial || !data.rendered;
+  if(copy && data.type == GL_TRIANGLES)
+    timing::count(timing::TRIANGLES,data.indices.size()/3);
   if(color) registerBuffer(data.Vertices,data.VerticesBuffer,copy);
   else if(normal) registerBuffer(data.vertices,data.verticesBuffer,copy);
   else registerBuffer(data.vertices0,data.vertices0Buffer,copy);
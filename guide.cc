@@ -4,6 +4,8 @@
  *
  *****/
 
+#include <vector>
+
 #include "guide.h"
 
 namespace camp {
@@ -23,18 +25,53 @@ multiguide::multiguide(guidevector& v)
   length = base->size();
 }
 
+multiguide::multiguide(guide *g)
+{
+  multiguide *rg = dynamic_cast<multiguide *>(g);
+  if (rg && rg->base->size() == rg->length)
+    base = rg->base;
+  else {
+    base = new guidevector;
+    base->push_back(g);
+  }
+
+  length = base->size();
+}
+
+namespace {
+struct flatframe {
+  const multiguide *g;
+  size_t i;
+  bool last; // Whether g is the last subguide at every enclosing level.
+
+  flatframe(const multiguide *g, bool last) : g(g), i(0), last(last) {}
+};
+}
+
 void multiguide::flatten(flatguide& g, bool allowsolve)
 {
-  size_t n=length;
-  if(n > 0) {
-    for(size_t i=0; i+1 < n; ++i) {
-      subguide(i)->flatten(g,allowsolve);
-      if(!allowsolve && subguide(i)->cyclic()) {
-        g.precyclic(true);
-        g.resolvecycle();
-      }
+  // Nested multiguides are expanded with an explicit stack, so that a guide
+  // is flattened in one scan however deeply it is nested.  An interior cycle
+  // is resolved after any subguide that is not last at every level.
+  std::vector<flatframe> stack;
+  stack.push_back(flatframe(this,true));
+  while (!stack.empty()) {
+    flatframe& f = stack.back();
+    if (f.i == f.g->length) {
+      stack.pop_back();
+      continue;
+    }
+    guide *s = f.g->subguide(f.i++);
+    bool last = f.last && f.i == f.g->length;
+    if (multiguide *m = dynamic_cast<multiguide *>(s)) {
+      stack.push_back(flatframe(m,last));
+      continue;
+    }
+    s->flatten(g,allowsolve);
+    if (!allowsolve && !last && s->cyclic()) {
+      g.precyclic(true);
+      g.resolvecycle();
     }
-    subguide(n-1)->flatten(g,allowsolve);
   }
 }
 
@@ -112,6 +112,50 @@ public:
   }
 };
 
+// A guide z[0]..z[1].. ..z[n-1], followed by ..cycle if cycles is true,
+// built from an array of pairs without a pairguide for each point.
+class dotsguide : public guide {
+  const pair *z;
+  Int n;
+  bool cycles;
+
+public:
+  void flatten(flatguide& g, bool allowsolve=true) {
+    for(Int i=0; i < n; ++i)
+      g.add(z[i]);
+    if(cycles) {
+      if(allowsolve)
+        g.solve(true);
+      else
+        g.close();
+    }
+  }
+
+  dotsguide(const pair *z, Int n, bool cycles=false)
+    : z(z), n(n), cycles(cycles) {}
+
+  path solve() {
+    return solveDots(z,n,cycles);
+  }
+
+  bool cyclic() {return cycles;}
+
+  void print(ostream& out) const {
+    for(Int i=0; i < n; ++i) {
+      if(i > 0) out << endl << "..";
+      out << z[i];
+    }
+    if(cycles) {
+      if(n > 0) out << endl << "..";
+      out << "cycle";
+    }
+  }
+
+  side printLocation() const {
+    return END;
+  }
+};
+
 // Tension expressions are evaluated to this class before being cast to a guide,
 // so that they can be cast to other types (such as guide3) instead.
 class tensionSpecifier : public gc {
@@ -243,6 +287,18 @@ public:
 
   multiguide(guidevector& v);
 
+  // Starts a guide with the subguide g, to be followed by the subguides given
+  // to push.  If g is itself a multiguide whose base is not used beyond its
+  // length, the base is shared and extended in place, so that building a
+  // guide by repeated joins takes linear time.
+  multiguide(guide *g);
+
+  void push(guide *g) {
+    assert(length == base->size());
+    base->push_back(g);
+    ++length;
+  }
+
   void flatten(flatguide&, bool=true);
 
   bool cyclic() {
@@ -156,6 +156,11 @@ public:
   template<typename T>
   friend inline T get(const item&);
 
+#if COMPACT
+  template<typename T>
+  friend inline T unboxed(const item&);
+#endif
+
   friend inline bool isdefault(const item&);
 
   friend ostream& operator<< (ostream& out, const item& i);
@@ -294,6 +299,25 @@ inline bool get<bool>(const item& it)
   throw vm::bad_item_value();
 }
 
+#if COMPACT
+// Read an unboxed real or integer without checking for an empty item.
+// Callers must verify that the item is not empty.
+template<typename T>
+inline T unboxed(const item& it);
+
+template <>
+inline double unboxed<double>(const item& it)
+{
+  return it.x;
+}
+
+template <>
+inline Int unboxed<Int>(const item& it)
+{
+  return it.i;
+}
+#endif
+
 #if !COMPACT
 // This serves as the object for representing a default argument.
 struct default_t : public gc {};
@@ -3,11 +3,17 @@
 #include "settings.h"
 #include "glrender.h"
 #include "drawelement.h"
+#include "timing.h"
 
 using namespace settings;
 
 namespace camp {
 
+jsfile::~jsfile()
+{
+  if(out.is_open()) timing::wrote(out);
+}
+
 void jsfile::copy(string name, bool header)
 {
   std::ifstream fin(locateFile(name).c_str());
@@ -14,7 +14,7 @@ class jsfile {
 
 public:
   jsfile() {}
-  ~jsfile() {}
+  ~jsfile();
 
   void copy(string name, bool header=false);
 
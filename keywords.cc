@@ -0,0 +1,46 @@
+/*****
+ * This file is automatically generated by keywords.pl.
+ * Changes will be overwritten.
+ *****/
+
+ADD(and);
+ADD(controls);
+ADD(tension);
+ADD(atleast);
+ADD(curl);
+ADD(if);
+ADD(else);
+ADD(while);
+ADD(for);
+ADD(do);
+ADD(return);
+ADD(break);
+ADD(continue);
+ADD(struct);
+ADD(typedef);
+ADD(new);
+ADD(access);
+ADD(import);
+ADD(unravel);
+ADD(from);
+ADD(include);
+ADD(quote);
+ADD(static);
+ADD(public);
+ADD(private);
+ADD(restricted);
+ADD(this);
+ADD(explicit);
+ADD(true);
+ADD(false);
+ADD(null);
+ADD(cycle);
+ADD(newframe);
+ADD(operator);
+ADD(quit);
+ADD(q);
+ADD(exit);
+ADD(reset);
+ADD(erase);
+ADD(help);
+ADD(input);
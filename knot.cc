@@ -784,7 +784,8 @@ struct controlDuplicates : public knoteffect {
   void end(Int) { /* No next point to compare with. */ }
 };
 
-path solve(knotlist& l)
+// Solves a knotlist with arbitrary specifiers.
+static path solveKnots(knotlist& l)
 {
   if (l.empty())
     return path();
@@ -798,6 +799,177 @@ path solve(knotlist& l)
   }
 }
 
+/***** Open guides *****/
+
+// The guide z[0]..z[1].. ..z[n-1] of knots with open specifiers and unit
+// tension arises from graphs and from joining arrays of pairs, and can be
+// very long.  It is solved here in one pass over contiguous storage, with
+// the same arithmetic as the general solver above but without building the
+// intermediate vectors for each property.
+
+// The quantities computed at each knot.
+struct dotsKnot {
+  pair dz;          // The displacement to the next knot.
+  double d;         // The distance to the next knot.
+  double psi;       // The turning angle at the knot.
+  double post,aug;  // The row-reduced equation for theta.
+  double w;         // The coefficient of theta[0] in a cyclic equation.
+  double theta;
+};
+
+// The open specifiers with unit tension do not break a guide into sections
+// unless two consecutive knots coincide.
+static bool simpleDots(const pair *z, Int n, bool cycles)
+{
+  if(n < 3) return false;
+  for(Int j=1; j < n; ++j)
+    if(z[j] == z[j-1]) return false;
+  return !cycles || z[n-1] != z[0];
+}
+
+static bool unitTension(const tension& t)
+{
+  return t.val == 1.0 && !t.atleast;
+}
+
+// Returns true if every knot of l is open with unit tension.
+static bool openKnots(knotlist& l)
+{
+  Int n=l.size();
+  for(Int j=0; j < n; ++j) {
+    knot& k=l[j];
+    if(!k.in->open() || !k.out->open() || !unitTension(k.tin) ||
+       !unitTension(k.tout)) return false;
+  }
+  return true;
+}
+
+path solveDots(const pair *z, Int n, bool cycles)
+{
+  if(!simpleDots(z,n,cycles)) {
+    static spec open;
+    cvector<knot> nodes(n);
+    for(Int j=0; j < n; ++j)
+      nodes[j]=knot(z[j],&open,&open);
+    simpleknotlist l(nodes,cycles);
+    return solveKnots(l);
+  }
+
+  Int m=cycles ? n : n-1;
+  vector<dotsKnot> K(n);
+
+  for(Int j=0; j < m; ++j) {
+    K[j].dz=z[j+1 < n ? j+1 : 0]-z[j];
+    K[j].d=length(K[j].dz);
+  }
+  if(!cycles) {
+    K[m].dz=pair(0,0);
+    K[m].d=0;
+  }
+
+  for(Int j=0; j < n; ++j)
+    K[j].psi=(cycles || (j > 0 && j < m)) ?
+      niceAngle(K[j].dz/K[j > 0 ? j-1 : n-1].dz) : 0;
+
+  // The equation pre*theta[j-1]+piv*theta[j]+post*theta[j+1]=aug at knot j;
+  // see eqnprop and curlSpec.
+  bool homogeneous=true;
+  double last=0,lastaug=0,lastw=1;
+  double pre0=0,piv0=0,post0=0,aug0=0;
+  for(Int j=0; j < n; ++j) {
+    double pre,piv,post,aug;
+    if(!cycles && j == 0) {
+      pre=0; piv=3.0; post=3.0; aug=-3.0*K[1].psi;
+    } else if(!cycles && j == m) {
+      pre=3.0; piv=3.0; post=0; aug=0;
+    } else {
+      double inFactor=1.0/K[j > 0 ? j-1 : n-1].d;
+      double A=inFactor;
+      double B=2.0*inFactor;
+      double outFactor=1.0/K[j].d;
+      double C=2.0*outFactor;
+      double D=outFactor;
+      pre=A; piv=B+C; post=D;
+      aug=-B*K[j].psi-D*K[j+1 < n ? j+1 : 0].psi;
+    }
+    if(aug != 0) homogeneous=false;
+
+    if(j == 0) {
+      // In the cyclic case, the first equation is reduced last.
+      pre0=pre; piv0=piv; post0=post; aug0=aug;
+      if(cycles) {
+        K[0].post=0; K[0].aug=0; K[0].w=1;
+        continue;
+      }
+    }
+
+    // Eliminate theta[j-1] and scale the pivot to one; see ref and recalc.
+    double p=piv-pre*last;
+    K[j].post=last=post/p;
+    K[j].aug=lastaug=(aug-pre*lastaug)/p;
+    K[j].w=lastw=-pre*lastw/p;
+  }
+
+  if(homogeneous)
+    for(Int j=0; j < n; ++j)
+      K[j].theta=0;
+  else if(cycles) {
+    double p=piv0-pre0*last;
+    K[0].post=post0/p;
+    K[0].aug=(aug0-pre0*lastaug)/p;
+    K[0].w=-pre0*lastw/p;
+
+    // See solveForTheta0 and backsubCyclic.
+    double a=0,b=0,c=1;
+    for(Int j=0; j < n; ++j) {
+      a+=c*K[j].aug;
+      b+=c*K[j].w;
+      c=-c*K[j].post;
+    }
+    double theta0=a/(1.0-(b+c));
+    double lastTheta=theta0;
+    for(Int j=n-1; j >= 0; --j)
+      lastTheta=K[j].theta=-K[j].post*lastTheta+K[j].aug+K[j].w*theta0;
+  } else {
+    double lastTheta=K[m].theta=K[m].aug;
+    for(Int j=m-1; j >= 0; --j)
+      lastTheta=K[j].theta=-K[j].post*lastTheta+K[j].aug;
+  }
+
+  // Compute the control points; see postcontrolprop and precontrolprop.
+  solvedKnot *nodes=path::allocate(n);
+  for(Int j=0; j < n; ++j) {
+    solvedKnot& k=nodes[j];
+    k.point=z[j];
+    double phi=-K[j].psi-K[j].theta;
+    if(cycles || j < m) {
+      Int next=j+1 < n ? j+1 : 0;
+      double nextphi=-K[next].psi-K[next].theta;
+      k.post=z[j]+velocity(K[j].theta,nextphi,tension())*expi(K[j].theta)*
+        K[j].dz;
+    } else k.post=z[j];
+    if(cycles || j > 0) {
+      Int prev=j > 0 ? j-1 : n-1;
+      k.pre=z[j]-velocity(phi,K[prev].theta,tension())*expi(-phi)*
+        K[prev].dz;
+    } else k.pre=z[j];
+  }
+  return path(nodes,n,cycles);
+}
+
+path solve(knotlist& l)
+{
+  if (!l.empty() && openKnots(l)) {
+    Int n=l.size();
+    vector<pair> z(n);
+    for(Int j=0; j < n; ++j)
+      z[j]=l[j].z;
+    return solveDots(&z[0],n,l.cyclic());
+  }
+  else
+    return solveKnots(l);
+}
+
 // Code for Testing
 #if 0
 path solveSimple(cvector<pair>& z)
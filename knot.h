@@ -521,6 +521,10 @@ public:
 
 path solve(knotlist& l);
 
+// Solves the guide z[0]..z[1].. ..z[n-1], followed by ..cycle if cycles is
+// true.
+path solveDots(const pair *z, Int n, bool cycles=false);
+
 path solveSimple(cvector<pair>& z);
 
 double velocity(double theta, double phi, tension t);
@@ -0,0 +1,511 @@
+// Hand-written stand-in for the flex-generated lexer of camp.l, used only to
+// link a local test binary where flex is unavailable.  Not part of the repo.
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <regex>
+
+#include "util.h"
+#include "modifier.h"
+#include "exp.h"
+#include "stm.h"
+#include "fundec.h"
+#include "errormsg.h"
+#include "interact.h"
+#include "lexical.h"
+
+using namespace absyntax;
+using mem::string;
+
+#include "camp.tab.h"
+#include "opsymbols.h"
+
+fileinfo* fi;
+Int tokPos;
+Int charPos;
+bool eof;
+string eofMessage;
+extern errorstream em;
+
+typedef size_t (*input_f) (char* bif, size_t max_size);
+static input_f yy_input = NULL;
+static std::string buf;
+static size_t cur;
+static bool loaded;
+static const char *yytext;
+static std::string yytextbuf;
+static int yyleng;
+
+void setlexer(input_f input, string filename)
+{
+  charPos=1;
+  fi = new fileinfo(filename);
+  yy_input = input;
+  tokPos = charPos = 1;
+  eof=false;
+  eofMessage="<no eof>";
+  buf.clear(); cur=0; loaded=false;
+}
+
+position lexerPos()
+{
+  position p;
+  p.init(fi, tokPos);
+  return p;
+}
+
+namespace {
+position here() { return lexerPos(); }
+
+void settext(size_t len)
+{
+  yytextbuf=buf.substr(cur,len);
+  yytext=yytextbuf.c_str();
+  yyleng=(int) len;
+  cur += len;
+}
+
+void adjust()
+{
+  tokPos = charPos;
+  charPos += yyleng;
+  yylval.pos = here();
+}
+
+void savesymbol(symbol name)
+{
+  adjust();
+  yylval.ps.pos=yylval.pos;
+  yylval.ps.sym=name;
+}
+
+void makesymbol()
+{
+  savesymbol(symbol::rawTrans(yytext, yyleng+1));
+}
+
+void makeopsymbol()
+{
+  savesymbol(symbol::opTrans(yytext));
+}
+
+void makemod(trans::modifier mod) {
+  yylval.mod.pos=here();
+  yylval.mod.val=mod;
+}
+
+void makeperm(trans::permission perm) {
+  yylval.perm.pos=here();
+  yylval.perm.val=perm;
+}
+
+void newline()
+{
+  fi->newline();
+  charPos = tokPos = 1;
+}
+
+void error(void)
+{
+  em.error(here());
+}
+}
+
+void setEOF(string message) {
+  eof=true;
+  eofMessage=message;
+}
+
+bool lexerEOF()
+{
+  return eof;
+}
+
+void reportEOF() {
+  assert(eof);
+  error();
+  em << eofMessage;
+  em.sync();
+}
+
+position stringpos;
+string stringbuild;
+
+namespace {
+void startstring()
+{
+  adjust();
+  stringpos = here();
+}
+
+void append(char c)
+{
+  stringbuild.push_back(c);
+  yylval.pos = here();
+}
+
+void getstring(void)
+{
+  yylval.stre = new stringExp(stringpos, stringbuild);
+  string().swap(stringbuild);
+}
+
+void load()
+{
+  if(loaded) return;
+  loaded=true;
+  char b[8192];
+  size_t n;
+  while((n=yy_input(b,sizeof(b))) > 0)
+    buf.append(b,n);
+}
+
+bool at(const char *s)
+{
+  return buf.compare(cur,strlen(s),s) == 0;
+}
+
+// Length of ENDL (\\?(\r\n|\n|\r)) at position p, or 0.
+size_t endl(size_t p)
+{
+  size_t q=p;
+  if(q < buf.size() && buf[q] == '\\') ++q;
+  if(q < buf.size() && buf[q] == '\r') {
+    ++q;
+    if(q < buf.size() && buf[q] == '\n') ++q;
+    return q-p;
+  }
+  if(q < buf.size() && buf[q] == '\n') return q+1-p;
+  return 0;
+}
+
+// Does ([ \t]|ENDL)*[\"\'] follow position p?
+bool concat(size_t p)
+{
+  for(;;) {
+    if(p >= buf.size()) return false;
+    if(buf[p] == ' ' || buf[p] == '\t') {++p; continue;}
+    size_t e=endl(p);
+    if(e) {p += e; continue;}
+    return buf[p] == '"' || buf[p] == '\'';
+  }
+}
+
+bool letter(char c) {return c == '_' || isalpha((unsigned char) c);}
+
+size_t identlen()
+{
+  size_t p=cur;
+  if(p >= buf.size() || !letter(buf[p])) return 0;
+  ++p;
+  while(p < buf.size() && (letter(buf[p]) || isdigit((unsigned char) buf[p])))
+    ++p;
+  return p-cur;
+}
+
+struct op {const char *s; int tok; symbol *sym; bool self;};
+
+size_t numlen(bool& real)
+{
+  static std::regex I("[0-9]+");
+  static std::regex R("([0-9]*\\.[0-9]+)|([0-9]+\\.[0-9]*)|([0-9]*\\.*[0-9]+e[-+]*[0-9]+)|([0-9]+\\.[0-9]*e[-+]*[0-9]+)");
+  size_t best=0;
+  real=false;
+  if(!(isdigit((unsigned char) buf[cur]) || buf[cur] == '.')) return 0;
+  std::string s=buf.substr(cur,256);
+  // Longest match over the alternatives.
+  const char *alts[]={"[0-9]*\\.[0-9]+","[0-9]+\\.[0-9]*",
+                      "[0-9]*\\.*[0-9]+e[-+]*[0-9]+",
+                      "[0-9]+\\.[0-9]*e[-+]*[0-9]+"};
+  std::smatch m;
+  if(std::regex_search(s,m,I,std::regex_constants::match_continuous))
+    best=m.length(0);
+  static std::regex *rs=NULL;
+  if(!rs) {
+    rs=new std::regex[4];
+    for(size_t i=0; i < 4; ++i) rs[i]=std::regex(std::string(alts[i]));
+  }
+  if(!(isdigit((unsigned char) buf[cur]) || buf[cur] == '.')) return 0;
+  for(size_t i=0; i < 4; ++i) {
+    std::regex& r=rs[i];
+    // Greedy regex may not give the longest match for every alternative,
+    // but these are simple enough.
+    if(std::regex_search(s,m,r,std::regex_constants::match_continuous) &&
+       (size_t) m.length(0) > best) {
+      best=m.length(0);
+      real=true;
+    }
+  }
+  return best;
+}
+
+enum {INITIAL, OPNAME};
+int state=INITIAL;
+}
+
+int yylex(void)
+{
+  load();
+  static const char *extraops[]={"<<",">>","$$","$","@@","@","~","<>"};
+  struct opdef {const char *s; int tok; const symbol *sym; int kind;};
+  // kind 0: adjust only; 1: DEFSYMBOL; 2: savesymbol as SELFOP/CARET
+  static const opdef ops[]={
+    {",",',',0,0},{":",':',0,0},{";",';',0,0},{"(",'(',0,0},{")",')',0,0},
+    {"[",'[',0,0},{"]",']',0,0},{"{",'{',0,0},{"}",'}',0,0},{".",'.',0,0},
+    {"...",ELLIPSIS,0,0},
+    {"+",'+',&SYM_PLUS,1},{"-",'-',&SYM_MINUS,1},{"*",'*',&SYM_TIMES,1},
+    {"/",'/',&SYM_DIVIDE,1},{"#",'#',&SYM_QUOTIENT,1},{"%",'%',&SYM_MOD,1},
+    {"^",'^',&SYM_CARET,1},{"**",'^',&SYM_CARET,1},{"?",'?',0,0},
+    {"=",ASSIGN,0,0},{"==",EQ,&SYM_EQ,1},{"!=",NEQ,&SYM_NEQ,1},
+    {"<",LT,&SYM_LT,1},{"<=",LE,&SYM_LE,1},{">",GT,&SYM_GT,1},
+    {">=",GE,&SYM_GE,1},{"&&",CAND,&SYM_CAND,1},{"||",COR,&SYM_COR,1},
+    {"!",OPERATOR,&SYM_LOGNOT,1},{"^^",CARETS,&SYM_CARETS,1},
+    {"::",COLONS,&SYM_COLONS,1},{"++",INCR,&SYM_INCR,1},
+    {"..",DOTS,&SYM_DOTS,1},{"--",DASHES,&SYM_DASHES,1},
+    {"---",LONGDASH,&SYM_LONGDASH,1},{"&",AMPERSAND,&SYM_AMPERSAND,1},
+    {"|",BAR,&SYM_BAR,1},
+    {"+=",SELFOP,&SYM_PLUS,1},{"-=",SELFOP,&SYM_MINUS,1},
+    {"*=",SELFOP,&SYM_TIMES,1},{"/=",SELFOP,&SYM_DIVIDE,1},
+    {"#=",SELFOP,&SYM_QUOTIENT,1},{"%=",SELFOP,&SYM_MOD,1},
+    {"^=",SELFOP,&SYM_CARET,1},
+  };
+
+  for(;;) {
+    if(cur >= buf.size()) {
+      if(state == OPNAME) {
+        yyleng=0; adjust();
+        setEOF("missing operator name");
+        state=INITIAL;
+        return GARBAGE;
+      }
+      setEOF("unexpected end of input");
+      return 0;
+    }
+
+    if(state == OPNAME) {
+      char c=buf[cur];
+      if(c == ' ' || c == '\t' || c == '\r') {
+        size_t e=endl(cur);
+        if(e) {settext(e); adjust(); newline(); continue;}
+        settext(1); adjust(); continue;
+      }
+      size_t e=endl(cur);
+      if(e) {settext(e); adjust(); newline(); continue;}
+      if(at("**")) {settext(2); savesymbol(SYM_CARET); state=INITIAL;
+        return ID;}
+      static const char *opnames[]={"---","==","!=","<=",">=","^^","..","::",
+                                    "--","++","<<",">>","$$","@@","<>",
+                                    "-","+","*","/","#","%","^","!","<",">",
+                                    "&","|","$","@","~"};
+      bool done=false;
+      for(size_t i=0; i < sizeof(opnames)/sizeof(char*); ++i)
+        if(at(opnames[i])) {
+          settext(strlen(opnames[i]));
+          makeopsymbol();
+          done=true;
+          break;
+        }
+      if(done) {state=INITIAL; return ID;}
+      size_t n=identlen();
+      if(n) {settext(n); makeopsymbol(); state=INITIAL; return ID;}
+      settext(1);
+      continue;
+    }
+
+    char c=buf[cur];
+    if(c == ' ' || c == '\t') {settext(1); adjust(); continue;}
+    size_t e=endl(cur);
+    if(e) {settext(e); adjust(); newline(); continue;}
+    if(at("//")) {
+      size_t p=buf.find('\n',cur);
+      if(p == std::string::npos) p=buf.size();
+      settext(p-cur); adjust(); continue;
+    }
+    if(at("/*")) {
+      settext(2); adjust();
+      for(;;) {
+        if(cur >= buf.size()) {
+          yyleng=0; adjust();
+          setEOF("comment not terminated");
+          return GARBAGE;
+        }
+        if(at("*/")) {settext(2); adjust(); break;}
+        size_t e=endl(cur);
+        if(e && buf[cur] != '\\') {settext(e); adjust(); newline(); continue;}
+        settext(1); adjust();
+      }
+      continue;
+    }
+    if(c == '"' || c == '\'') {
+      settext(1);
+      startstring();
+      char q=c;
+      for(;;) {
+        if(cur >= buf.size()) {
+          yyleng=0; adjust();
+          setEOF("string not terminated");
+          getstring();
+          return GARBAGE;
+        }
+        char d=buf[cur];
+        if(d == q) {
+          if(concat(cur+1)) {
+            settext(1); adjust();
+            // Skip to the next quote, as flex would in INITIAL.
+            for(;;) {
+              char f=buf[cur];
+              if(f == ' ' || f == '\t') {settext(1); adjust(); continue;}
+              size_t e=endl(cur);
+              if(e) {settext(e); adjust(); newline(); continue;}
+              break;
+            }
+            q=buf[cur];
+            settext(1);
+            startstring();
+            continue;
+          }
+          settext(1); adjust();
+          getstring();
+          return STRING;
+        }
+        size_t e=endl(cur);
+        if(e) {settext(e); adjust(); newline(); append('\n'); continue;}
+        if(q == '"') {
+          if(at("\\\\")) {settext(2); adjust(); append('\\'); append('\\');
+            continue;}
+          if(at("\\\"")) {settext(2); adjust(); append('"'); continue;}
+          settext(1); adjust(); append(*yytext);
+          continue;
+        }
+        if(d == '\\' && cur+1 < buf.size()) {
+          char x=buf[cur+1];
+          const char *simple="\'\"?\\";
+          if(strchr(simple,x)) {settext(2); adjust(); append(x); continue;}
+          const char *esc="abfnrtv";
+          const char *val="\a\b\f\n\r\t\v";
+          const char *p=strchr(esc,x);
+          if(p && x) {settext(2); adjust(); append(val[p-esc]); continue;}
+          if(x >= '0' && x <= '7') {
+            size_t n=1;
+            int v=x-'0';
+            while(n < 3 && cur+1+n < buf.size() && buf[cur+1+n] >= '0' &&
+                  buf[cur+1+n] <= '7' && !(n == 2 && x > '3')) {
+              v=v*8+buf[cur+1+n]-'0'; ++n;
+            }
+            settext(n+1); adjust(); append((char) v); continue;
+          }
+          if(x == 'x') {
+            auto hex=[](char h) {return (h >= '0' && h <= '9') ||
+                (h >= 'A' && h <= 'F') || h == ',';};
+            if(cur+2 < buf.size() && hex(buf[cur+2])) {
+              auto v=[](char h) {return h <= '9' ? h-'0' : 10+h-'A';};
+              int r=v(buf[cur+2]);
+              size_t n=3;
+              if(cur+3 < buf.size() && hex(buf[cur+3])) {
+                r=r*16+v(buf[cur+3]); n=4;
+              }
+              settext(n); adjust(); append((char) r); continue;
+            }
+          }
+        }
+        settext(1); adjust(); append(*yytext);
+      }
+    }
+
+    // Longest match among numbers, operators and identifiers.
+    bool real;
+    size_t nlen=numlen(real);
+    size_t olen=0;
+    const opdef *o=NULL;
+    for(size_t i=0; i < sizeof(ops)/sizeof(opdef); ++i) {
+      size_t l=strlen(ops[i].s);
+      if(l > olen && at(ops[i].s)) {olen=l; o=ops+i;}
+    }
+    size_t xlen=0;
+    for(size_t i=0; i < sizeof(extraops)/sizeof(char*); ++i) {
+      size_t l=strlen(extraops[i]);
+      if(l > xlen && at(extraops[i])) xlen=l;
+    }
+    size_t ilen=identlen();
+
+    size_t best=std::max(std::max(nlen,olen),std::max(xlen,ilen));
+    if(best == 0) {
+      settext(1); adjust();
+      error();
+      em << "invalid token";
+      if (isgraph(yytext[0]))
+        em << " '" << yytext[0] << "'";
+      continue;
+    }
+
+    if(ilen == best) {
+      settext(ilen);
+      std::string s(yytext);
+      struct kw {const char *s; int tok;};
+      static const kw plain[]={
+        {"and",AND},{"if",IF},{"else",ELSE},{"while",WHILE},{"for",FOR},
+        {"do",DO},{"return",RETURN_},{"break",BREAK},{"continue",CONTINUE},
+        {"struct",STRUCT},{"typedef",TYPEDEF},{"new",NEW},{"access",ACCESS},
+        {"import",IMPORT},{"unravel",UNRAVEL},{"from",FROM},
+        {"include",INCLUDE},{"quote",QUOTE},{"this",THIS},
+        {"explicit",EXPLICIT}};
+      for(size_t i=0; i < sizeof(plain)/sizeof(kw); ++i)
+        if(s == plain[i].s) {adjust(); return plain[i].tok;}
+      if(s == "controls") {savesymbol(SYM_CONTROLS); return CONTROLS;}
+      if(s == "tension") {savesymbol(SYM_TENSION); return TENSION;}
+      if(s == "atleast") {savesymbol(SYM_ATLEAST); return ATLEAST;}
+      if(s == "curl") {savesymbol(SYM_CURL); return CURL;}
+      if(s == "static") {adjust(); makemod(trans::EXPLICIT_STATIC);
+        return MODIFIER;}
+      if(s == "public") {adjust(); makeperm(trans::PUBLIC); return PERM;}
+      if(s == "private") {adjust(); makeperm(trans::PRIVATE); return PERM;}
+      if(s == "restricted") {adjust(); makeperm(trans::RESTRICTED);
+        return PERM;}
+      if(s == "true") {adjust(); yylval.e=new booleanExp(here(),true);
+        return LIT;}
+      if(s == "false") {adjust(); yylval.e=new booleanExp(here(),false);
+        return LIT;}
+      if(s == "null") {adjust(); yylval.e=new nullExp(here()); return LIT;}
+      if(s == "cycle") {adjust(); yylval.e=new cycleExp(here()); return LIT;}
+      if(s == "newframe") {adjust(); yylval.e=new newPictureExp(here());
+        return LIT;}
+      if(s == "operator") {adjust(); state=OPNAME; continue;}
+      makesymbol();
+      return ID;
+    }
+
+    if(nlen == best && (nlen > olen || !o)) {
+      settext(nlen);
+      adjust();
+      if(real) {
+        try {
+          yylval.e=new realExp(here(), lexical::cast<double>(yytext));
+        } catch (lexical::bad_cast&) {
+          error(); em << "invalid real";
+          yylval.e=new realExp(here(), 0);
+        }
+      } else {
+        try {
+          yylval.e=new intExp(here(), lexical::cast<Int>(yytext));
+        } catch (lexical::bad_cast&) {
+          error(); em << "invalid integer";
+          yylval.e=new intExp(here(), 0);
+        }
+      }
+      return LIT;
+    }
+
+    if(olen >= xlen) {
+      settext(olen);
+      if(o->sym) savesymbol(*o->sym);
+      else adjust();
+      return o->tok;
+    }
+    settext(xlen);
+    makeopsymbol();
+    return OPERATOR;
+  }
+}
+int yy_flex_debug;
@@ -24,6 +24,7 @@
 #endif
 
 #include <iostream>
+#include <fstream>
 #include <cstdlib>
 #include <cerrno>
 #include <sys/wait.h>
@@ -45,6 +46,9 @@
 #include "fileio.h"
 
 #include "stack.h"
+#include "memprofile.h"
+#include "sampler.h"
+#include "timing.h"
 
 using namespace settings;
 
@@ -132,6 +136,23 @@ void *asymain(void *A)
   Args *args=(Args *) A;
   fpu_trap(trap());
 
+  bool profilealloc=getSetting<bool>("profilealloc");
+  if(profilealloc) vm::beginAllocationProfile();
+
+  string timingformat=getSetting<string>("timing");
+  if(!timingformat.empty()) {
+    if(timingformat != "table" && timingformat != "json")
+      cerr << "warning: unknown timing format " << timingformat
+           << "; using table" << endl;
+    timing::begin();
+  }
+
+  string profile=getSetting<string>("profile");
+  if(!profile.empty()) {
+    Int rate=getSetting<Int>("profilerate");
+    vm::beginSampling(rate > 0 ? (size_t) rate : 1);
+  }
+
   if(interactive) {
     Signal(SIGINT,interruptHandler);
     processPrompt();
@@ -177,6 +198,18 @@ void *asymain(void *A)
   vm::dumpProfile();
 #endif
 
+  if(profilealloc) vm::dumpAllocationProfile(cerr);
+
+  if(!timingformat.empty())
+    timing::report(cerr,timingformat == "json");
+
+  if(!profile.empty()) {
+    std::ofstream out(profile.c_str());
+    vm::endSampling(out);
+    if(!out)
+      cerr << "Cannot write profile " << profile << endl;
+  }
+
   if(getSetting<bool>("wait")) {
     int status;
     while(wait(&status) > 0);
@@ -45,6 +45,13 @@
 #define CONST const
 #endif
 
+namespace mem {
+// Set while allocations are being attributed to the instructions of the
+// virtual machine that make them (see memprofile.h).
+extern bool profiling;
+void profile(size_t n);
+}
+
 #ifdef USEGC
 
 #define GC_THREADS
@@ -61,6 +68,7 @@ extern "C" {
 
 inline void *asy_malloc(size_t n)
 {
+  if(mem::profiling) mem::profile(n);
 #ifdef GC_DEBUG
   if(void *mem=GC_debug_malloc_ignore_off_page(n, GC_EXTRAS))
 #else
@@ -72,6 +80,7 @@ inline void *asy_malloc(size_t n)
 
 inline void *asy_malloc_atomic(size_t n)
 {
+  if(mem::profiling) mem::profile(n);
 #ifdef GC_DEBUG
   if(void *mem=GC_debug_malloc_atomic_ignore_off_page(n, GC_EXTRAS))
 #else
@@ -83,9 +92,13 @@ inline void *asy_malloc_atomic(size_t n)
 
 #undef GC_MALLOC
 #undef GC_MALLOC_ATOMIC
+#undef GC_MALLOC_IGNORE_OFF_PAGE
+#undef GC_MALLOC_ATOMIC_IGNORE_OFF_PAGE
 
 #define GC_MALLOC(sz) asy_malloc(sz)
 #define GC_MALLOC_ATOMIC(sz) asy_malloc_atomic(sz)
+#define GC_MALLOC_IGNORE_OFF_PAGE(sz) asy_malloc(sz)
+#define GC_MALLOC_ATOMIC_IGNORE_OFF_PAGE(sz) asy_malloc_atomic(sz)
 
 #include <gc_allocator.h>
 #include <gc_cpp.h>
@@ -103,10 +116,12 @@ class gc_cleanup {};
 enum GCPlacement {UseGC, NoGC, PointerFreeGC};
 
 inline void* operator new(size_t size, GCPlacement) {
+  if(mem::profiling) mem::profile(size);
   return operator new(size);
 }
 
 inline void* operator new[](size_t size, GCPlacement) {
+                           if(mem::profiling) mem::profile(size);
                            return operator new(size);
                          }
 
@@ -0,0 +1,120 @@
+/*****
+ * memprofile.cc
+ *
+ * Attribute the allocations made while running the virtual machine to the
+ * instructions and source positions that make them.
+ *****/
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "memprofile.h"
+#include "program.h"
+#include "profiler.h"
+#include "vm.h"
+
+namespace mem {
+bool profiling=false;
+}
+
+namespace vm {
+
+namespace {
+
+// The allocations made by the instructions with one opcode or builtin at one
+// source position. The bookkeeping uses the standard allocator so that it is
+// neither collected nor profiled itself.
+struct site {
+  size_t count;
+  size_t bytes;
+  const codeLabel *label;
+  site() : count(0), bytes(0), label(NULL) {}
+};
+
+typedef std::unordered_map<codeSite,site,codeSiteHash> sitemap;
+sitemap sites;
+
+std::thread::id owner;
+bool recording=false;
+
+codeLabels labels;
+
+struct total {
+  size_t count;
+  size_t bytes;
+  total() : count(0), bytes(0) {}
+};
+
+typedef std::map<std::string,total> totals;
+typedef std::pair<std::string,total> entry;
+
+bool larger(const entry& a, const entry& b)
+{
+  return a.second.bytes > b.second.bytes;
+}
+
+void print(std::ostream& out, const char *title, const totals& t,
+           size_t lines)
+{
+  std::vector<entry> v(t.begin(),t.end());
+  std::sort(v.begin(),v.end(),larger);
+  out << title << ":" << std::endl
+      << std::setw(12) << "count" << std::setw(14) << "bytes" << std::endl;
+  for(size_t i=0; i < v.size() && i < lines; ++i)
+    out << std::setw(12) << v[i].second.count
+        << std::setw(14) << v[i].second.bytes << "  " << v[i].first
+        << std::endl;
+}
+
+}
+
+void beginAllocationProfile()
+{
+  owner=std::this_thread::get_id();
+  mem::profiling=true;
+}
+
+void dumpAllocationProfile(std::ostream& out, size_t lines)
+{
+  mem::profiling=false;
+
+  totals byInst,byPos;
+  for(sitemap::const_iterator p=sites.begin(); p != sites.end(); ++p) {
+    const site& s=p->second;
+    const codeLabel *l=s.label;
+    total& a=byInst[l ? l->name : "<outside the virtual machine>"];
+    a.count += s.count;
+    a.bytes += s.bytes;
+    total& b=byPos[l && !l->where.empty() ? l->where : "<no position>"];
+    b.count += s.count;
+    b.bytes += s.bytes;
+  }
+  print(out,"Allocations by instruction",byInst,lines);
+  out << std::endl;
+  print(out,"Allocations by source position",byPos,lines);
+  sites.clear();
+  labels.clear();
+}
+
+} // namespace vm
+
+namespace mem {
+
+void profile(size_t n)
+{
+  // Skip allocations made by other threads and by the profiler itself.
+  if(vm::recording || std::this_thread::get_id() != vm::owner) return;
+  vm::recording=true;
+  const vm::inst *i=vm::getInst();
+  vm::site& s=vm::sites[i ? vm::codeSite(*i) : vm::codeSite(nullPos)];
+  if(s.count == 0 && i) s.label=&vm::labels(*i);
+  ++s.count;
+  s.bytes += n;
+  vm::recording=false;
+}
+
+} // namespace mem
@@ -0,0 +1,24 @@
+/*****
+ * memprofile.h
+ *
+ * Attribute the allocations made while running the virtual machine to the
+ * instructions and source positions that make them.
+ *****/
+
+#ifndef MEMPROFILE_H
+#define MEMPROFILE_H
+
+#include <iostream>
+
+namespace vm {
+
+// Start recording the allocations made by the calling thread.
+void beginAllocationProfile();
+
+// Stop recording and write the allocation counts and bytes, largest first,
+// by opcode or builtin and by source position.
+void dumpAllocationProfile(std::ostream& out, size_t lines=20);
+
+} // namespace vm
+
+#endif
@@ -0,0 +1,134 @@
+/*****
+ * numformat.cc
+ *
+ * Fast formatting of reals for the output backends.
+ *****/
+
+#include <cmath>
+#include <cstdint>
+
+#include "numformat.h"
+
+namespace camp {
+
+namespace {
+
+// Powers of ten that are exactly representable as doubles.
+const double pow10[]={1e0,1e1,1e2,1e3,1e4,1e5,1e6,1e7,1e8,1e9,1e10,1e11,
+                      1e12,1e13,1e14,1e15,1e16,1e17,1e18,1e19,1e20,1e21,
+                      1e22};
+
+const uint64_t ipow10[]={1ULL,10ULL,100ULL,1000ULL,10000ULL,100000ULL,
+                         1000000ULL,10000000ULL,100000000ULL,
+                         1000000000ULL,10000000000ULL,100000000000ULL,
+                         1000000000000ULL,10000000000000ULL,
+                         100000000000000ULL,1000000000000000ULL,
+                         10000000000000000ULL};
+
+// The largest precision for which the scaled digits stay below 2^53.
+const int maxprecision=15;
+
+// Round a*10^k to the nearest integer in N, returning false if the
+// rounding of the exact decimal value cannot be decided in floating point.
+bool roundscaled(double a, int k, uint64_t& N)
+{
+  double scaled=k >= 0 ? a*pow10[k] : a/pow10[-k];
+  if(scaled >= 9e15) return false;
+  double r=floor(scaled);
+  double frac=scaled-r;
+  // The scaled value carries a relative rounding error of at most 2^-53.
+  if(fabs(frac-0.5) <= scaled*2.3e-16) return false;
+  N=(uint64_t) r+(frac > 0.5);
+  return true;
+}
+
+// Write the n least significant digits of N, including leading zeros.
+char *digits(char *p, uint64_t N, int n)
+{
+  for(int i=n-1; i >= 0; --i) {
+    p[i]=(char) ('0'+N % 10);
+    N /= 10;
+  }
+  return p+n;
+}
+
+// Write N without leading zeros.
+char *integer(char *p, uint64_t N)
+{
+  int n=1;
+  while(n < 16 && N >= ipow10[n]) ++n;
+  return digits(p,N,n);
+}
+
+}
+
+size_t formatReal(char *buf, double x, int precision, bool fixed)
+{
+  if(!std::isfinite(x)) return 0;
+  if(precision < 0) precision=6;
+
+  char *p=buf;
+  if(std::signbit(x)) *(p++)='-';
+  double a=fabs(x);
+
+  if(fixed) {
+    if(precision > maxprecision) return 0;
+    uint64_t N;
+    if(!roundscaled(a,precision,N)) return 0;
+    p=integer(p,N/ipow10[precision]);
+    if(precision > 0) {
+      *(p++)='.';
+      p=digits(p,N % ipow10[precision],precision);
+    }
+    return p-buf;
+  }
+
+  if(precision == 0) precision=1;
+  if(precision > maxprecision) return 0;
+
+  if(a == 0.0) {
+    *(p++)='0';
+    return p-buf;
+  }
+
+  // Values below 1e-5 always use an exponent.
+  if(a < 1e-5 || a >= 1e15) return 0;
+
+  // Find the decimal exponent e of a after rounding to precision digits.
+  int e=(int) floor(log10(a));
+  uint64_t N;
+  for(int i=0;; ++i) {
+    if(i == 3 || !roundscaled(a,precision-1-e,N)) return 0;
+    if(N >= ipow10[precision]) ++e;
+    else if(N < ipow10[precision-1]) --e;
+    else break;
+  }
+
+  if(e < -4 || e >= precision) return 0;
+
+  // Drop trailing zeros.
+  int n=precision;
+  while(n > 1 && N % 10 == 0) {
+    N /= 10;
+    --n;
+  }
+
+  if(e >= 0) {
+    if(n <= e+1)
+      p=integer(p,N*ipow10[e+1-n]);
+    else {
+      p=integer(p,N/ipow10[n-e-1]);
+      *(p++)='.';
+      p=digits(p,N % ipow10[n-e-1],n-e-1);
+    }
+  } else {
+    *(p++)='0';
+    *(p++)='.';
+    for(int i=-1; i > e; --i)
+      *(p++)='0';
+    p=digits(p,N,n);
+  }
+  return p-buf;
+}
+
+} //namespace camp
@@ -0,0 +1,97 @@
+/*****
+ * numformat.h
+ *
+ * Fast formatting of reals for the output backends.
+ *****/
+
+#ifndef NUMFORMAT_H
+#define NUMFORMAT_H
+
+#include <iostream>
+#include <cstring>
+
+namespace camp {
+
+// Format x into buf exactly as an ostream with the given precision would
+// (%.*g, or %.*f if fixed), returning the length written. A return value
+// of 0 means the caller must fall back to the ostream (exponents, ties
+// too close to call, non-finite values, or excessive precision).
+// buf must hold at least 32 characters.
+size_t formatReal(char *buf, double x, int precision, bool fixed=false);
+
+// Collect reals and text destined for an ostream in a local buffer and
+// write them out with a single call, honouring the precision and the
+// fixed flag of the stream. Streams with other formatting flags, or a
+// pending field width, are written to directly.
+class realbuffer {
+  static const size_t size=256;
+  std::ostream& out;
+  char buf[size];
+  size_t n;
+  int precision;
+  bool fixed;
+  bool fast;
+
+  void reserve(size_t m) {
+    if(n+m > size) flush();
+  }
+
+public:
+  realbuffer(std::ostream& out) : out(out), n(0) {
+    std::ios::fmtflags flags=out.flags();
+    precision=(int) out.precision();
+    fixed=(flags & std::ios::floatfield) == std::ios::fixed;
+    fast=(fixed || (flags & std::ios::floatfield) == 0) &&
+      (flags & (std::ios::showpoint | std::ios::showpos |
+                std::ios::uppercase)) == 0 && out.width() == 0;
+  }
+
+  ~realbuffer() {flush();}
+
+  void flush() {
+    if(n) {
+      out.write(buf,n);
+      n=0;
+    }
+  }
+
+  realbuffer& operator << (double x) {
+    if(fast) {
+      reserve(32);
+      size_t m=formatReal(buf+n,x,precision,fixed);
+      if(m) {
+        n += m;
+        return *this;
+      }
+      flush();
+    }
+    out << x;
+    return *this;
+  }
+
+  realbuffer& operator << (char c) {
+    if(fast) {
+      reserve(1);
+      buf[n++]=c;
+    } else out << c;
+    return *this;
+  }
+
+  realbuffer& operator << (const char *s) {
+    size_t m=strlen(s);
+    if(!fast) out << s;
+    else if(m > size) {
+      flush();
+      out.write(s,m);
+    } else {
+      reserve(m);
+      memcpy(buf+n,s,m);
+      n += m;
+    }
+    return *this;
+  }
+};
+
+} //namespace camp
+
+#endif
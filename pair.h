@@ -21,6 +21,7 @@
 
 #include "common.h"
 #include "angle.h"
+#include "numformat.h"
 
 namespace camp {
 
@@ -35,6 +36,11 @@ public:
     (std::ofstream&)(*this) << x;
     return *this;
   }
+
+  jsofstream& operator << (double x) {
+    realbuffer(*this) << x;
+    return *this;
+  }
 };
 
 class pair : public gc {
@@ -221,13 +227,13 @@ public:
 
   friend ostream& operator << (ostream& out, const pair& z)
   {
-    out << "(" << z.x << "," << z.y << ")";
+    realbuffer(out) << '(' << z.x << ',' << z.y << ')';
     return out;
   }
 
   friend jsofstream& operator << (jsofstream& out, const pair& z)
   {
-    out << "[" << z.x << "," << z.y << "]";
+    realbuffer(out) << '[' << z.x << ',' << z.y << ']';
     return out;
   }
 
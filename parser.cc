@@ -25,6 +25,7 @@
 #include "errormsg.h"
 #include "parser.h"
 #include "util.h"
+#include "timing.h"
 
 // The lexical analysis and parsing functions used by parseFile.
 void setlexer(size_t (*input) (char* bif, size_t max_size), string filename);
@@ -67,6 +68,7 @@ void error(const string& filename)
 absyntax::file *doParse(size_t (*input) (char* bif, size_t max_size),
                         const string& filename, bool extendable=false)
 {
+  timing::timer parsing(timing::PARSE);
   setlexer(input,filename);
   absyntax::file *root = yyparse() == 0 ? absyntax::root : 0;
   absyntax::root = 0;
@@ -220,6 +220,20 @@ cubicroots::cubicroots(double a, double b, double c, double d)
   }
 }
 
+// Evaluate the Bezier segment a,b,c,d at time t by de Casteljau's algorithm.
+inline pair casteljau(const pair& a, const pair& b, const pair& c,
+                      const pair& d, double t)
+{
+  double one_t = 1.0-t;
+  pair ab   = one_t*a   + t*b,
+    bc   = one_t*b   + t*c,
+    cd   = one_t*c   + t*d,
+    abc  = one_t*ab  + t*bc,
+    bcd  = one_t*bc  + t*cd,
+    abcd = one_t*abc + t*bcd;
+  return abcd;
+}
+
 pair path::point(double t) const
 {
   checkEmpty(n);
@@ -240,20 +254,119 @@ pair path::point(double t) const
   else
     iplus = i+1;
 
-  double one_t = 1.0-t;
+  return casteljau(nodes[i].point,nodes[i].post,nodes[iplus].pre,
+                   nodes[iplus].point,t);
+}
 
-  pair a = nodes[i].point,
-    b = nodes[i].post,
-    c = nodes[iplus].pre,
-    d = nodes[iplus].point,
-    ab   = one_t*a   + t*b,
-    bc   = one_t*b   + t*c,
-    cd   = one_t*c   + t*d,
-    abc  = one_t*ab  + t*bc,
-    bcd  = one_t*bc  + t*cd,
-    abcd = one_t*abc + t*bcd;
+// The batched evaluations below reuse the data of a segment for
+// consecutive times in it, and agree exactly with the scalar versions.
 
-  return abcd;
+void path::point(pair *z, const double *t, size_t m) const
+{
+  checkEmpty(n);
+
+  Int last=-1;
+  pair a,b,c,d;
+  for(size_t k=0; k < m; ++k) {
+    double s=t[k];
+    Int i=Floor(s);
+    Int iplus;
+    s=fmod(s,1);
+    if(s < 0) s += 1;
+
+    if(cycles) {
+      i=imod(i,n);
+      iplus=imod(i+1,n);
+    } else if(i < 0) {
+      z[k]=nodes[0].point;
+      continue;
+    } else if(i >= n-1) {
+      z[k]=nodes[n-1].point;
+      continue;
+    } else
+      iplus=i+1;
+
+    if(i != last) {
+      a=nodes[i].point;
+      b=nodes[i].post;
+      c=nodes[iplus].pre;
+      d=nodes[iplus].point;
+      last=i;
+    }
+    z[k]=casteljau(a,b,c,d,s);
+  }
+}
+
+void path::dir(pair *z, const double *t, size_t m, bool normalize) const
+{
+  bool cached=false;
+  Int last=0;
+  pair a,b,c;
+  double epsilon=0.0;
+  for(size_t k=0; k < m; ++k) {
+    double s=t[k];
+    if(!cycles && (s <= 0 || s >= n-1)) {
+      z[k]=dir(s,normalize);
+      continue;
+    }
+    Int i=Floor(s);
+    s -= i;
+    if(s == 0) {
+      z[k]=dir(i,0,normalize);
+      continue;
+    }
+    if(!cached || i != last) {
+      pair z0=point(i);
+      pair c0=postcontrol(i);
+      pair c1=precontrol(i+1);
+      pair z1=point(i+1);
+      a=3.0*(z1-z0)+9.0*(c0-c1);
+      b=6.0*(z0+c1)-12.0*c0;
+      c=3.0*(c0-z0);
+      epsilon=norm(z0,c0,c1,z1);
+      last=i;
+      cached=true;
+    }
+    pair dir=a*s*s+b*s+c;
+    if(!normalize) z[k]=dir;
+    else if(dir.abs2() > epsilon) z[k]=unit(dir);
+    else {
+      dir=2.0*a*s+b;
+      z[k]=dir.abs2() > epsilon ? unit(dir) : unit(a);
+    }
+  }
+}
+
+void path::accel(pair *z, const double *t, size_t m) const
+{
+  bool cached=false;
+  Int last=0;
+  pair a,b,c;
+  for(size_t k=0; k < m; ++k) {
+    double s=t[k];
+    if(!cycles && (s <= 0 || s >= n-1)) {
+      z[k]=accel(s);
+      continue;
+    }
+    Int i=Floor(s);
+    s -= i;
+    if(s == 0) {
+      z[k]=0.5*(postaccel(i)+preaccel(i));
+      continue;
+    }
+    if(!cached || i != last) {
+      pair z0=point(i);
+      pair c0=postcontrol(i);
+      pair c1=precontrol(i+1);
+      pair z1=point(i+1);
+      a=z1-z0+3.0*(c0-c1);
+      b=6.0*(z0+c1);
+      c=12.0*c0;
+      last=i;
+      cached=true;
+    }
+    z[k]=6.0*s*a+b-c;
+  }
 }
 
 pair path::precontrol(double t) const
@@ -270,9 +383,9 @@ pair path::precontrol(double t) const
     iplus = imod(i+1,n);
   }
   else if (i < 0)
-    return nodes[0].pre;
+    return precontrol((Int) 0);
   else if (i >= n-1)
-    return nodes[n-1].pre;
+    return precontrol((Int) (n-1));
   else
     iplus = i+1;
 
@@ -285,7 +398,7 @@ pair path::precontrol(double t) const
     bc   = one_t*b   + t*c,
     abc  = one_t*ab  + t*bc;
 
-  return (abc == a) ? nodes[i].pre : abc;
+  return (abc == a) ? precontrol(i) : abc;
 }
 
 
@@ -303,9 +416,9 @@ pair path::postcontrol(double t) const
     iplus = imod(i+1,n);
   }
   else if (i < 0)
-    return nodes[0].post;
+    return postcontrol((Int) 0);
   else if (i >= n-1)
-    return nodes[n-1].post;
+    return postcontrol(n-1);
   else
     iplus = i+1;
 
@@ -318,12 +431,12 @@ pair path::postcontrol(double t) const
     cd   = one_t*c   + t*d,
     bcd  = one_t*bc  + t*cd;
 
-  return (bcd == d) ? nodes[iplus].post : bcd;
+  return (bcd == d) ? postcontrol(iplus) : bcd;
 }
 
 path path::reverse() const
 {
-  mem::vector<solvedKnot> nodes(n);
+  solvedKnot *nodes=allocate(n);
   Int len=length();
   for (Int i = 0, j = len; i < n; i++, j--) {
     nodes[i].pre = postcontrol(j);
@@ -359,7 +472,10 @@ path path::subpath(Int a, Int b) const
   }
 
   Int sn = b-a+1;
-  mem::vector<solvedKnot> nodes(sn);
+  if (a >= 0 && b < n)
+    return path(*this, a, sn);
+
+  solvedKnot *nodes=allocate(sn);
 
   for (Int i = 0, j = a; j <= b; i++, j++) {
     nodes[i].pre = precontrol(j);
@@ -636,69 +752,106 @@ double path::cubiclength(Int i, double goal) const
   return -t;
 }
 
+void path::measure(double *L) const
+{
+  if(n == 0) return;
+  Int len=length();
+  double sum=0.0;
+  L[0]=sum;
+  for(Int i=0; i < len; ++i)
+    L[i+1]=sum += cubiclength(i);
+}
+
+const double *path::arclengths() const
+{
+  if(!storage) return NULL;
+  // The segments of a view are segments of the knots it was taken from, so
+  // it shares their table, measured up to the last knot.
+  Int start=nodes-storage->knots();
+  Int len=start+length();
+  if(storage->measured < len) {
+    if(view) {
+      path whole(storage->knots(),storage->n);
+      whole.measure(storage->lengths());
+      storage->measured=storage->n-1;
+    } else {
+      measure(storage->lengths());
+      storage->measured=len;
+    }
+  }
+  return storage->lengths()+start;
+}
+
 double path::arclength() const
 {
   if (cached_length != -1) return cached_length;
 
-  double L=0.0;
+  const double *L=arclengths();
+  if(L) return cached_length=L[length()]-L[0];
+
+  double sum=0.0;
   for (Int i = 0; i < n-1; i++) {
-    L += cubiclength(i);
+    sum += cubiclength(i);
   }
-  if(cycles) L += cubiclength(n-1);
-  cached_length = L;
+  if(cycles) sum += cubiclength(n-1);
+  cached_length = sum;
   return cached_length;
 }
 
-double path::arctime(double goal) const
+// Return the time at which the arclength goal is reached, given the
+// cumulative arclengths L of the segments.
+double path::arctime(const double *L, double goal) const
 {
+  if(n == 0) return goal <= 0 ? 0 : length();
+  Int len=length();
+  double base=L[0];
+  double total=L[len]-base;
   if (cycles) {
-    if (goal == 0 || cached_length == 0) return 0;
-    if (goal < 0)  {
-      const path &rp = this->reverse();
-      double result = -rp.arctime(-goal);
-      return result;
-    }
-    if (cached_length > 0 && goal >= cached_length) {
-      Int loops = (Int)(goal / cached_length);
-      goal -= loops*cached_length;
-      return loops*n+arctime(goal);
+    if (goal == 0 || total == 0) return 0;
+    if (goal < 0 || goal >= total) {
+      double loops=floor(goal/total);
+      goal -= loops*total;
+      if(goal >= total) {
+        goal=0;
+        ++loops;
+      }
+      return loops*n+(goal > 0 ? arctime(L,goal) : 0);
     }
   } else {
     if (goal <= 0)
       return 0;
-    if (cached_length > 0 && goal >= cached_length)
-      return n-1;
+    if (goal >= total)
+      return len;
   }
 
-  double l,L=0;
-  for (Int i = 0; i < n-1; i++) {
-    l = cubiclength(i,goal);
-    if (l < 0)
-      return (-l+i);
-    else {
-      L += l;
-      goal -= l;
-      if (goal <= 0)
-        return i+1;
-    }
-  }
-  if (cycles) {
-    l = cubiclength(n-1,goal);
-    if (l < 0)
-      return -l+n-1;
-    if (cached_length > 0 && cached_length != L+l) {
-      reportError("arclength != length.\n"
-                  "path::arclength(double) must have broken semantics.\n"
-                  "Please report this error.");
-    }
-    cached_length = L += l;
-    goal -= l;
-    return arctime(goal)+n;
-  }
-  else {
-    cached_length = L;
-    return length();
+  // Locate the first knot at which the goal is attained.
+  Int i=std::lower_bound(L,L+len+1,goal,[base](double l, double goal) {
+      return l-base < goal;})-L;
+  if(i == 0 || L[i]-base == goal) return i;
+  --i;
+  double l=cubiclength(i,goal-(L[i]-base));
+  return l < 0 ? i-l : i+1;
+}
+
+void path::arctime(double *t, const double *l, size_t m) const
+{
+  const double *L=arclengths();
+  double *temp=NULL;
+  if(!L) {
+    temp=new double[length()+1];
+    measure(temp);
+    L=temp;
   }
+  for(size_t i=0; i < m; ++i)
+    t[i]=arctime(L,l[i]);
+  delete[] temp;
+}
+
+double path::arctime(double goal) const
+{
+  double t;
+  arctime(&t,&goal,1);
+  return t;
 }
 
 // }}}
@@ -762,6 +915,79 @@ double path::directiontime(const pair& dir) const {
 }
 // }}}
 
+// {{{ Flattening
+
+// The maximum number of chords used to approximate a single segment.
+const Int maxchords=1 << 16;
+
+// Return the number of chords of equal parameter length that approximate the
+// cubic Bezier segment z0,c0,c1,z1 to within the given distance, by Wang's
+// bound on the second differences of the control points.
+Int chords(const pair& z0, const pair& c0, const pair& c1, const pair& z1,
+           double tolerance)
+{
+  double L=std::max((z0-2.0*c0+c1).length(),(c0-2.0*c1+z1).length());
+  double n=ceil(sqrt(0.75*L/tolerance));
+  return n <= 1 ? 1 : n >= maxchords ? maxchords : (Int) n;
+}
+
+void path::flatten(std::vector<pair>& z, double tolerance) const
+{
+  if(!(tolerance > 0))
+    reportError("flattening tolerance must be positive");
+  if(n == 0) return;
+
+  Int len=length();
+  z.push_back(point((Int) 0));
+  for(Int i=0; i < len; ++i) {
+    pair z0=point(i);
+    pair z1=point(i+1);
+    if(!straight(i)) {
+      pair c0=postcontrol(i);
+      pair c1=precontrol(i+1);
+      Int m=chords(z0,c0,c1,z1,tolerance);
+      if(m > 1) {
+        // Evaluate the polynomial form of the segment at each interior time.
+        pair b=3.0*(c0-z0);
+        pair c=3.0*(c1-2.0*c0+z0);
+        pair d=z1-z0+3.0*(c0-c1);
+        size_t k=z.size();
+        z.resize(k+m-1);
+        double dt=1.0/m;
+        for(Int j=1; j < m; ++j) {
+          double t=j*dt;
+          z[k+j-1]=((d*t+c)*t+b)*t+z0;
+        }
+      }
+    }
+    if(!cycles || i+1 < len)
+      z.push_back(z1);
+  }
+}
+
+path straightpath(const std::vector<pair>& z, bool cycles)
+{
+  Int m=z.size();
+  solvedKnot *nodes=path::allocate(m);
+  for(Int i=0; i < m; ++i) {
+    const pair& v=z[i];
+    nodes[i].point=v;
+    nodes[i].pre=i > 0 || cycles ? v+(z[i > 0 ? i-1 : m-1]-v)/3.0 : v;
+    nodes[i].post=i+1 < m || cycles ? v+(z[i+1 < m ? i+1 : 0]-v)/3.0 : v;
+    nodes[i].straight=true;
+  }
+  if(!cycles && m > 0) nodes[m-1].straight=false;
+  return path(nodes,m,cycles);
+}
+
+path path::flatten(double tolerance) const
+{
+  std::vector<pair> z;
+  flatten(z,tolerance);
+  return straightpath(z,cycles);
+}
+// }}}
+
 // {{{ Path Intersection Calculations
 
 const unsigned maxdepth=DBL_MANT_DIG;
@@ -967,6 +1193,84 @@ void intersections(std::vector<double>& S, path& g,
     add(S,S1[i],g,fuzz2);
 }
 
+// Paths with more than this many segments in total are intersected
+// segment by segment after pruning pairs with disjoint bounding boxes.
+static const Int sweepsegments=16;
+
+// The bounding box of the control polygon of segment i of path p or q.
+struct segmentBox {
+  bbox box;
+  Int i;
+  bool q;
+  segmentBox(const path& g, Int i, bool q, double fuzz) : i(i), q(q) {
+    box=bbox(g.point(i));
+    box.addnonempty(g.postcontrol(i));
+    box.addnonempty(g.precontrol(i+1));
+    box.addnonempty(g.point(i+1));
+    // Allow for the fuzz on the segments of one path only.
+    if(!q) {
+      box.left -= fuzz;
+      box.bottom -= fuzz;
+      box.right += fuzz;
+      box.top += fuzz;
+    }
+  }
+  bool operator < (const segmentBox& b) const {return box.left < b.box.left;}
+};
+
+// Find all intersections of p and q by sweeping the segment bounding boxes
+// from left to right, intersecting only those pairs of segments whose
+// boxes overlap.
+static bool sweepintersections(std::vector<double>& S, std::vector<double>& T,
+                               path& p, path& q, double fuzz, bool exact,
+                               unsigned depth)
+{
+  double fuzz2=max(fuzzFactor*fuzz*fuzz,Fuzz2);
+  Int lp=p.length();
+  Int lq=q.length();
+
+  std::vector<segmentBox> boxes;
+  boxes.reserve(lp+lq);
+  for(Int i=0; i < lp; ++i)
+    boxes.push_back(segmentBox(p,i,false,fuzz));
+  for(Int j=0; j < lq; ++j)
+    boxes.push_back(segmentBox(q,j,true,fuzz));
+  sort(boxes.begin(),boxes.end());
+
+  std::vector<std::pair<Int,Int> > candidates;
+  std::vector<const segmentBox *> active[2];
+  for(size_t k=0; k < boxes.size(); ++k) {
+    const segmentBox& b=boxes[k];
+    std::vector<const segmentBox *>& other=active[!b.q];
+    size_t m=0;
+    for(size_t l=0; l < other.size(); ++l) {
+      const segmentBox *a=other[l];
+      if(a->box.right < b.box.left) continue; // Retire a.
+      other[m++]=a;
+      if(a->box.top >= b.box.bottom && b.box.top >= a->box.bottom)
+        candidates.push_back(b.q ? std::make_pair(a->i,b.i) :
+                             std::make_pair(b.i,a->i));
+    }
+    other.resize(m);
+    active[b.q].push_back(&b);
+  }
+  sort(candidates.begin(),candidates.end());
+
+  double s,t;
+  std::vector<double> S1,T1;
+  for(size_t k=0; k < candidates.size(); ++k) {
+    Int i=candidates[k].first;
+    Int j=candidates[k].second;
+    path pi=p.subpath(i,i+1);
+    path qj=q.subpath(j,j+1);
+    S1.clear();
+    T1.clear();
+    if(intersections(s,t,S1,T1,pi,qj,fuzz,false,exact,depth))
+      add(s,t,S,T,S1,T1,1.0,1.0,i,j,p,fuzz2,false);
+  }
+  return S.size() > 0;
+}
+
 bool intersections(double &s, double &t, std::vector<double>& S,
                    std::vector<double>& T, path& p, path& q,
                    double fuzz, bool single, bool exact, unsigned depth)
@@ -1017,6 +1321,9 @@ bool intersections(double &s, double &t, std::vector<double>& S,
       return true;
     }
 
+    if(!single && lp > 0 && lq > 0 && lp+lq > sweepsegments)
+      return sweepintersections(S,T,p,q,fuzz,exact,depth);
+
     path p1,p2;
     double pscale,poffset;
     std::vector<double> S1,T1;
@@ -1134,7 +1441,7 @@ path concat(const path& p1, const path& p2)
   if (n1 == -1) return p2;
   if (n2 == -1) return p1;
 
-  mem::vector<solvedKnot> nodes(n1+n2+1);
+  solvedKnot *nodes=path::allocate(n1+n2+1);
 
   Int i = 0;
   nodes[0].pre = p1.point((Int) 0);
@@ -1288,14 +1595,124 @@ Int path::windingnumber(const pair& z) const
   return count;
 }
 
+windingIndex::windingIndex(const std::vector<const path *>& paths)
+  : paths(paths), bounds(paths.size()), nbuckets(1)
+{
+  size_t n=paths.size();
+  Int segments=0;
+  bbox b;
+  for(size_t k=0; k < n; ++k) {
+    const path& g=*paths[k];
+    if(!g.cyclic())
+      reportError("path is not cyclic");
+    bounds[k]=g.bounds();
+    b += bounds[k];
+    segments += g.length();
+  }
+  bottom=b.bottom;
+  top=b.top;
+
+  // A segment can only contribute to the winding number of points within
+  // the vertical extent of its control points.
+  std::vector<double> low,high;
+  low.reserve(segments);
+  high.reserve(segments);
+  double extent=0.0;
+  for(size_t k=0; k < n; ++k) {
+    const path& g=*paths[k];
+    Int L=g.length();
+    for(Int i=0; i < L; ++i) {
+      bbox B(g.point(i));
+      B.addnonempty(g.postcontrol(i));
+      B.addnonempty(g.precontrol(i+1));
+      B.addnonempty(g.point(i+1));
+      low.push_back(B.bottom);
+      high.push_back(B.top);
+      extent += B.top-B.bottom;
+    }
+  }
+
+  // A segment is entered in each bucket it spans, about 1+nbuckets*extent/
+  // height entries in all. Use one bucket per segment unless tall segments
+  // would then make more than twice as many entries as segments.
+  double height=top-bottom;
+  if(height > 0.0) {
+    double span=max(extent/height,1.0);
+    nbuckets=max((Int) min((double) segments,ceil(segments/span)),(Int) 1);
+  }
+  scale=height > 0.0 ? nbuckets/height : 0.0;
+
+  std::vector<size_t> first,last;
+  first.reserve(segments);
+  last.reserve(segments);
+  start.assign(nbuckets+1,0);
+  for(size_t m=0; m < low.size(); ++m) {
+    size_t kmin=bucket(low[m]);
+    size_t kmax=bucket(high[m]);
+    first.push_back(kmin);
+    last.push_back(kmax);
+    for(size_t j=kmin; j <= kmax; ++j)
+      ++start[j+1];
+  }
+  for(size_t j=0; j < nbuckets; ++j)
+    start[j+1] += start[j];
+
+  std::vector<size_t> next(start.begin(),start.end()-1);
+  entries.assign(start[nbuckets],entry(0,0));
+  size_t m=0;
+  for(size_t k=0; k < n; ++k) {
+    Int L=paths[k]->length();
+    for(Int i=0; i < L; ++i, ++m)
+      for(size_t j=first[m]; j <= last[m]; ++j)
+        entries[next[j]++]=entry(k,i);
+  }
+}
+
+Int windingIndex::windingnumber(const pair& z) const
+{
+  static const Int undefined=Int_MAX % 2 ? Int_MAX : Int_MAX-1;
+
+  double x=z.getx(), y=z.gety();
+  if(y < bottom || y > top) return 0;
+
+  // Entries within a bucket are ordered by path, so the contribution of
+  // each path can be accumulated separately, as in path::windingnumber.
+  size_t k=bucket(y);
+  Int count=0;
+  Int local=0;
+  Int current=-1;
+  bool skip=false;
+  for(size_t e=start[k]; e < start[k+1]; ++e) {
+    const entry& E=entries[e];
+    if(E.path != current) {
+      count += local;
+      local=0;
+      current=E.path;
+      const bbox& b=bounds[current];
+      skip=x < b.left || x > b.right || y < b.bottom || y > b.top;
+    }
+    if(skip) continue;
+    const path& g=*paths[current];
+    Int i=E.segment;
+    if(g.straight(i) ?
+       checkstraight(g.point(i),g.point(i+1),z,local) :
+       checkcurve(g.point(i),g.postcontrol(i),g.precontrol(i+1),g.point(i+1),
+                  z,local,maxdepth)) {
+      local=undefined;
+      skip=true;
+    }
+  }
+  return count+local;
+}
+
 path path::transformed(const transform& t) const
 {
-  mem::vector<solvedKnot> nodes(n);
+  solvedKnot *nodes=allocate(n);
 
   for (Int i = 0; i < n; ++i) {
-    nodes[i].pre = t * this->nodes[i].pre;
+    nodes[i].pre = t * precontrol(i);
     nodes[i].point = t * this->nodes[i].point;
-    nodes[i].post = t * this->nodes[i].post;
+    nodes[i].post = t * postcontrol(i);
     nodes[i].straight = this->nodes[i].straight;
   }
 
@@ -1306,7 +1723,7 @@ path path::transformed(const transform& t) const
 path transformed(const transform& t, const path& p)
 {
   Int n = p.size();
-  mem::vector<solvedKnot> nodes(n);
+  solvedKnot *nodes=path::allocate(n);
 
   for (Int i = 0; i < n; ++i) {
     nodes[i].pre = t * p.precontrol(i);
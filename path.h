@@ -12,6 +12,8 @@
 #define PATH_H
 
 #include <cfloat>
+#include <algorithm>
+#include <vector>
 
 #include "mod.h"
 #include "pair.h"
@@ -68,6 +70,35 @@ struct solvedKnot : public gc {
   }
 };
 
+// The knots of a path, followed by room for a table of the cumulative
+// arclengths of its segments, which is computed on demand.
+template<class Knot>
+struct knotStorage {
+  Int n;        // The number of knots.
+  Int measured; // The number of segments in the arclength table, or -1.
+
+  Knot *knots() {return (Knot *) (this+1);}
+  double *lengths() {return (double *) (knots()+n);}
+
+  static Knot *allocate(Int n) {
+    if(n <= 0) return NULL;
+    void *block=new(PointerFreeGC)
+      char[sizeof(knotStorage)+n*sizeof(Knot)+(n+1)*sizeof(double)];
+    knotStorage *s=(knotStorage *) block;
+    s->n=n;
+    s->measured=-1;
+    Knot *k=s->knots();
+    for(Int i=0; i < n; ++i)
+      new(k+i) Knot;
+    return k;
+  }
+
+  // The storage of knots obtained from allocate().
+  static knotStorage *of(const Knot *knots) {
+    return knots ? (knotStorage *) knots-1 : NULL;
+  }
+};
+
 extern const double Fuzz;
 extern const double Fuzz2;
 extern const double Fuzz4;
@@ -77,62 +108,115 @@ extern const double fuzzFactor;
 
 class path : public gc {
   bool cycles;  // If the path is closed in a loop
+  bool view;    // If the path is a subpath sharing the knots of another path
 
   Int n; // The number of knots
 
-  mem::vector<solvedKnot> nodes;
+  // Since paths are immutable, the knots are shared by all copies of a path
+  // and by subpaths that are contiguous runs of its knots, along with the
+  // arclength table. The storage is kept so that the collector can find it.
+  knotStorage<solvedKnot> *storage;
+  const solvedKnot *nodes;
   mutable double cached_length; // Cache length since path is immutable.
 
   mutable bbox box;
   mutable bbox times; // Times where minimum and maximum extents are attained.
 
+  // A view of the knots start,...,start+n-1 of the noncyclic path p.
+  path(const path& p, Int start, Int n)
+    : cycles(false), view(true), n(n), storage(p.storage),
+      nodes(p.nodes+start), cached_length(-1) {}
+
+  // Store the cumulative arclengths of the segments in L[0],...,L[length()].
+  void measure(double *L) const;
+
+  // Return the arclength table kept with the storage, starting at the first
+  // knot; for a view, the entries are offset by L[0].
+  const double *arclengths() const;
+
+  // Return the arctime of goal, given a table L from arclengths().
+  double arctime(const double *L, double goal) const;
+
 public:
+  // Allocate storage for n knots, to be filled in and passed to the
+  // constructor below.
+  static solvedKnot *allocate(Int n) {
+    return knotStorage<solvedKnot>::allocate(n);
+  }
+
   path()
-    : cycles(false), n(0), nodes(), cached_length(-1) {}
+    : cycles(false), view(false), n(0), storage(NULL), nodes(NULL),
+      cached_length(-1) {}
 
   // Create a path of a single point
   path(pair z, bool = false)
-    : cycles(false), n(1), nodes(1), cached_length(-1)
+    : cycles(false), view(false), n(1), cached_length(-1)
   {
-    nodes[0].pre = nodes[0].point = nodes[0].post = z;
-    nodes[0].straight = false;
+    solvedKnot *knots=allocate(1);
+    knots[0].pre = knots[0].point = knots[0].post = z;
+    knots[0].straight = false;
+    storage=knotStorage<solvedKnot>::of(knots);
+    nodes=knots;
   }
 
   // Creates path from a list of knots.  This will be used by camp
   // methods such as the guide solver, but should probably not be used by a
   // user of the system unless he knows what he is doing.
-  path(mem::vector<solvedKnot>& nodes, Int n, bool cycles = false)
-    : cycles(cycles), n(n), nodes(nodes), cached_length(-1)
+  path(const mem::vector<solvedKnot>& nodes, Int n, bool cycles = false)
+    : cycles(cycles), view(false), n(n), cached_length(-1)
   {
+    solvedKnot *knots=allocate(n);
+    std::copy(nodes.begin(),nodes.begin()+n,knots);
+    storage=knotStorage<solvedKnot>::of(knots);
+    this->nodes=knots;
   }
 
+  // Creates path from knots obtained from allocate(), which must not be
+  // modified afterwards.
+  path(const solvedKnot *nodes, Int n, bool cycles = false)
+    : cycles(cycles), view(false), n(n),
+      storage(knotStorage<solvedKnot>::of(nodes)), nodes(nodes),
+      cached_length(-1) {}
+
   friend bool operator== (const path& p, const path& q)
   {
-    return p.cycles == q.cycles && p.nodes == q.nodes;
+    if(p.cycles != q.cycles || p.n != q.n) return false;
+    for(Int i=0; i < p.n; ++i)
+      if(p.precontrol(i) != q.precontrol(i) || p.point(i) != q.point(i) ||
+         p.postcontrol(i) != q.postcontrol(i)) return false;
+    return true;
   }
 
 public:
   path(solvedKnot n1, solvedKnot n2)
-    : cycles(false), n(2), nodes(2), cached_length(-1)
+    : cycles(false), view(false), n(2), cached_length(-1)
   {
-    nodes[0] = n1;
-    nodes[1] = n2;
-    nodes[0].pre = nodes[0].point;
-    nodes[1].post = nodes[1].point;
+    solvedKnot *knots=allocate(2);
+    knots[0] = n1;
+    knots[1] = n2;
+    knots[0].pre = knots[0].point;
+    knots[1].post = knots[1].point;
+    storage=knotStorage<solvedKnot>::of(knots);
+    nodes=knots;
   }
 
-  // Copy constructor
+  // Copy constructor: the knots are shared.
   path(const path& p)
-    : cycles(p.cycles), n(p.n), nodes(p.nodes), cached_length(p.cached_length),
-      box(p.box), times(p.times)
+    : cycles(p.cycles), view(p.view), n(p.n), storage(p.storage),
+      nodes(p.nodes), cached_length(p.cached_length), box(p.box),
+      times(p.times)
   {}
 
   path unstraighten() const
   {
-    path P=path(*this);
-    for(int i=0; i < n; ++i)
-      P.nodes[i].straight=false;
-    return P;
+    solvedKnot *knots=allocate(n);
+    for(Int i=0; i < n; ++i) {
+      knots[i].pre=precontrol(i);
+      knots[i].point=nodes[i].point;
+      knots[i].post=postcontrol(i);
+      knots[i].straight=false;
+    }
+    return path(knots,n,cycles);
   }
 
   virtual ~path()
@@ -160,7 +244,7 @@ public:
     return cycles;
   }
 
-  mem::vector<solvedKnot>& Nodes() {
+  const solvedKnot *Nodes() const {
     return nodes;
   }
 
@@ -185,16 +269,22 @@ public:
 
   pair point(double t) const;
 
+  // Store in z[i] the point at time t[i], for i=0,...,m-1.
+  void point(pair *z, const double *t, size_t m) const;
+
+  // The end controls of a view are clamped to the endpoints.
   pair precontrol(Int t) const
   {
-    return nodes[adjustedIndex(t,n,cycles)].pre;
+    Int i=adjustedIndex(t,n,cycles);
+    return view && i == 0 ? nodes[i].point : nodes[i].pre;
   }
 
   pair precontrol(double t) const;
 
   pair postcontrol(Int t) const
   {
-    return nodes[adjustedIndex(t,n,cycles)].post;
+    Int i=adjustedIndex(t,n,cycles);
+    return view && i == n-1 ? nodes[i].point : nodes[i].post;
   }
 
   pair postcontrol(double t) const;
@@ -268,6 +358,9 @@ public:
     return unit(a);
   }
 
+  // Store in z[i] the direction at time t[i], for i=0,...,m-1.
+  void dir(pair *z, const double *t, size_t m, bool normalize=true) const;
+
   pair postaccel(Int t) const {
     if(!cycles && t >= n-1) return pair(0,0);
     pair z0=point(t);
@@ -305,6 +398,9 @@ public:
     return 6.0*t*(z1-z0+3.0*(c0-c1))+6.0*(z0+c1)-12.0*c0;
   }
 
+  // Store in z[i] the acceleration at time t[i], for i=0,...,m-1.
+  void accel(pair *z, const double *t, size_t m) const;
+
   // Returns the path traced out in reverse.
   path reverse() const;
 
@@ -354,8 +450,18 @@ public:
   double cubiclength(Int i, double goal=-1) const;
   double arclength () const;
   double arctime (double l) const;
+  // Store in t[i] the arctimes of the m arclengths l[i].
+  void arctime(double *t, const double *l, size_t m) const;
   double directiontime(const pair& z) const;
 
+  // Append to z the vertices of a polyline within distance tolerance of the
+  // path, beginning with point(0) and ending with point(length()), which is
+  // omitted for a cyclic path.
+  void flatten(std::vector<pair>& z, double tolerance) const;
+
+  // Return the polyline, as a piecewise straight path.
+  path flatten(double tolerance) const;
+
   pair max() const {
     checkEmpty(n);
     return bounds().Max();
@@ -385,6 +491,36 @@ public:
 
 };
 
+// An index of the segments of a set of cyclic paths, bucketed by their
+// vertical extent, for computing the winding numbers of many points.
+class windingIndex {
+  struct entry {
+    Int path;
+    Int segment;
+    entry(Int path, Int segment) : path(path), segment(segment) {}
+  };
+
+  std::vector<const path *> paths;
+  std::vector<bbox> bounds;
+  double bottom,top;
+  double scale; // Buckets per unit height.
+  size_t nbuckets;
+  std::vector<size_t> start; // Entries of bucket k are start[k],...
+  std::vector<entry> entries;
+
+  size_t bucket(double y) const {
+    double k=floor((y-bottom)*scale);
+    if(k <= 0) return 0;
+    return k < nbuckets-1 ? (size_t) k : nbuckets-1;
+  }
+
+public:
+  windingIndex(const std::vector<const path *>& paths);
+
+  // Return the sum of g.windingnumber(z) over the indexed paths g.
+  Int windingnumber(const pair& z) const;
+};
+
 double arcLength(const pair& z0, const pair& c0, const pair& c1,
                  const pair& z1);
 
@@ -406,6 +542,9 @@ void intersections(std::vector<double>& S, path& g,
 // Concatenates two paths into a new one.
 path concat(const path& p1, const path& p2);
 
+// Return the piecewise straight path through the vertices z.
+path straightpath(const std::vector<pair>& z, bool cycles);
+
 // Applies a transformation to the path
 path transformed(const transform& t, const path& p);
 
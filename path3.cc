@@ -24,6 +24,20 @@ void checkEmpty3(Int n) {
     reportError("nullpath3 has no points");
 }
 
+// Evaluate the Bezier segment a,b,c,d at time t by de Casteljau's algorithm.
+inline triple casteljau(const triple& a, const triple& b, const triple& c,
+                        const triple& d, double t)
+{
+  double one_t = 1.0-t;
+  triple ab   = one_t*a   + t*b,
+    bc   = one_t*b   + t*c,
+    cd   = one_t*c   + t*d,
+    abc  = one_t*ab  + t*bc,
+    bcd  = one_t*bc  + t*cd,
+    abcd = one_t*abc + t*bcd;
+  return abcd;
+}
+
 triple path3::point(double t) const
 {
   checkEmpty3(n);
@@ -44,20 +58,119 @@ triple path3::point(double t) const
   else
     iplus = i+1;
 
-  double one_t = 1.0-t;
+  return casteljau(nodes[i].point,nodes[i].post,nodes[iplus].pre,
+                   nodes[iplus].point,t);
+}
 
-  triple a = nodes[i].point,
-    b = nodes[i].post,
-    c = nodes[iplus].pre,
-    d = nodes[iplus].point,
-    ab   = one_t*a   + t*b,
-    bc   = one_t*b   + t*c,
-    cd   = one_t*c   + t*d,
-    abc  = one_t*ab  + t*bc,
-    bcd  = one_t*bc  + t*cd,
-    abcd = one_t*abc + t*bcd;
+// The batched evaluations below reuse the data of a segment for
+// consecutive times in it, and agree exactly with the scalar versions.
 
-  return abcd;
+void path3::point(triple *z, const double *t, size_t m) const
+{
+  checkEmpty3(n);
+
+  Int last=-1;
+  triple a,b,c,d;
+  for(size_t k=0; k < m; ++k) {
+    double s=t[k];
+    Int i=Floor(s);
+    Int iplus;
+    s=fmod(s,1);
+    if(s < 0) s += 1;
+
+    if(cycles) {
+      i=imod(i,n);
+      iplus=imod(i+1,n);
+    } else if(i < 0) {
+      z[k]=nodes[0].point;
+      continue;
+    } else if(i >= n-1) {
+      z[k]=nodes[n-1].point;
+      continue;
+    } else
+      iplus=i+1;
+
+    if(i != last) {
+      a=nodes[i].point;
+      b=nodes[i].post;
+      c=nodes[iplus].pre;
+      d=nodes[iplus].point;
+      last=i;
+    }
+    z[k]=casteljau(a,b,c,d,s);
+  }
+}
+
+void path3::dir(triple *z, const double *t, size_t m, bool normalize) const
+{
+  bool cached=false;
+  Int last=0;
+  triple a,b,c;
+  double epsilon=0.0;
+  for(size_t k=0; k < m; ++k) {
+    double s=t[k];
+    if(!cycles && (s <= 0 || s >= n-1)) {
+      z[k]=dir(s,normalize);
+      continue;
+    }
+    Int i=Floor(s);
+    s -= i;
+    if(s == 0) {
+      z[k]=dir(i,0,normalize);
+      continue;
+    }
+    if(!cached || i != last) {
+      triple z0=point(i);
+      triple c0=postcontrol(i);
+      triple c1=precontrol(i+1);
+      triple z1=point(i+1);
+      a=3.0*(z1-z0)+9.0*(c0-c1);
+      b=6.0*(z0+c1)-12.0*c0;
+      c=3.0*(c0-z0);
+      epsilon=norm(z0,c0,c1,z1);
+      last=i;
+      cached=true;
+    }
+    triple dir=a*s*s+b*s+c;
+    if(!normalize) z[k]=dir;
+    else if(dir.abs2() > epsilon) z[k]=unit(dir);
+    else {
+      dir=2.0*a*s+b;
+      z[k]=dir.abs2() > epsilon ? unit(dir) : unit(a);
+    }
+  }
+}
+
+void path3::accel(triple *z, const double *t, size_t m) const
+{
+  bool cached=false;
+  Int last=0;
+  triple a,b,c;
+  for(size_t k=0; k < m; ++k) {
+    double s=t[k];
+    if(!cycles && (s <= 0 || s >= n-1)) {
+      z[k]=accel(s);
+      continue;
+    }
+    Int i=Floor(s);
+    s -= i;
+    if(s == 0) {
+      z[k]=0.5*(postaccel(i)+preaccel(i));
+      continue;
+    }
+    if(!cached || i != last) {
+      triple z0=point(i);
+      triple c0=postcontrol(i);
+      triple c1=precontrol(i+1);
+      triple z1=point(i+1);
+      a=z1-z0+3.0*(c0-c1);
+      b=6.0*(z0+c1);
+      c=12.0*c0;
+      last=i;
+      cached=true;
+    }
+    z[k]=6.0*s*a+b-c;
+  }
 }
 
 triple path3::precontrol(double t) const
@@ -74,9 +187,9 @@ triple path3::precontrol(double t) const
     iplus = imod(i+1,n);
   }
   else if (i < 0)
-    return nodes[0].pre;
+    return precontrol((Int) 0);
   else if (i >= n-1)
-    return nodes[n-1].pre;
+    return precontrol((Int) (n-1));
   else
     iplus = i+1;
 
@@ -89,7 +202,7 @@ triple path3::precontrol(double t) const
     bc   = one_t*b   + t*c,
     abc  = one_t*ab  + t*bc;
 
-  return (abc == a) ? nodes[i].pre : abc;
+  return (abc == a) ? precontrol(i) : abc;
 }
 
 
@@ -107,9 +220,9 @@ triple path3::postcontrol(double t) const
     iplus = imod(i+1,n);
   }
   else if (i < 0)
-    return nodes[0].post;
+    return postcontrol((Int) 0);
   else if (i >= n-1)
-    return nodes[n-1].post;
+    return postcontrol(n-1);
   else
     iplus = i+1;
 
@@ -122,12 +235,12 @@ triple path3::postcontrol(double t) const
     cd   = one_t*c   + t*d,
     bcd  = one_t*bc  + t*cd;
 
-  return (bcd == d) ? nodes[iplus].post : bcd;
+  return (bcd == d) ? postcontrol(iplus) : bcd;
 }
 
 path3 path3::reverse() const
 {
-  mem::vector<solvedKnot3> nodes(n);
+  solvedKnot3 *nodes=allocate(n);
   Int len=length();
   for (Int i = 0, j = len; i < n; i++, j--) {
     nodes[i].pre = postcontrol(j);
@@ -163,7 +276,10 @@ path3 path3::subpath(Int a, Int b) const
   }
 
   Int sn = b-a+1;
-  mem::vector<solvedKnot3> nodes(sn);
+  if (a >= 0 && b < n)
+    return path3(*this, a, sn);
+
+  solvedKnot3 *nodes=allocate(sn);
 
   for (Int i = 0, j = a; j <= b; i++, j++) {
     nodes[i].pre = precontrol(j);
@@ -431,69 +547,106 @@ double path3::cubiclength(Int i, double goal) const
   return -t;
 }
 
+void path3::measure(double *L) const
+{
+  if(n == 0) return;
+  Int len=length();
+  double sum=0.0;
+  L[0]=sum;
+  for(Int i=0; i < len; ++i)
+    L[i+1]=sum += cubiclength(i);
+}
+
+const double *path3::arclengths() const
+{
+  if(!storage) return NULL;
+  // The segments of a view are segments of the knots it was taken from, so
+  // it shares their table, measured up to the last knot.
+  Int start=nodes-storage->knots();
+  Int len=start+length();
+  if(storage->measured < len) {
+    if(view) {
+      path3 whole(storage->knots(),storage->n);
+      whole.measure(storage->lengths());
+      storage->measured=storage->n-1;
+    } else {
+      measure(storage->lengths());
+      storage->measured=len;
+    }
+  }
+  return storage->lengths()+start;
+}
+
 double path3::arclength() const
 {
   if (cached_length != -1) return cached_length;
 
-  double L=0.0;
+  const double *L=arclengths();
+  if(L) return cached_length=L[length()]-L[0];
+
+  double sum=0.0;
   for (Int i = 0; i < n-1; i++) {
-    L += cubiclength(i);
+    sum += cubiclength(i);
   }
-  if(cycles) L += cubiclength(n-1);
-  cached_length = L;
+  if(cycles) sum += cubiclength(n-1);
+  cached_length = sum;
   return cached_length;
 }
 
-double path3::arctime(double goal) const
+// Return the time at which the arclength goal is reached, given the
+// cumulative arclengths L of the segments.
+double path3::arctime(const double *L, double goal) const
 {
+  if(n == 0) return goal <= 0 ? 0 : length();
+  Int len=length();
+  double base=L[0];
+  double total=L[len]-base;
   if (cycles) {
-    if (goal == 0 || cached_length == 0) return 0;
-    if (goal < 0)  {
-      const path3 &rp = this->reverse();
-      double result = -rp.arctime(-goal);
-      return result;
-    }
-    if (cached_length > 0 && goal >= cached_length) {
-      Int loops = (Int)(goal / cached_length);
-      goal -= loops*cached_length;
-      return loops*n+arctime(goal);
+    if (goal == 0 || total == 0) return 0;
+    if (goal < 0 || goal >= total) {
+      double loops=floor(goal/total);
+      goal -= loops*total;
+      if(goal >= total) {
+        goal=0;
+        ++loops;
+      }
+      return loops*n+(goal > 0 ? arctime(L,goal) : 0);
     }
   } else {
     if (goal <= 0)
       return 0;
-    if (cached_length > 0 && goal >= cached_length)
-      return n-1;
+    if (goal >= total)
+      return len;
   }
 
-  double l,L=0;
-  for (Int i = 0; i < n-1; i++) {
-    l = cubiclength(i,goal);
-    if (l < 0)
-      return (-l+i);
-    else {
-      L += l;
-      goal -= l;
-      if (goal <= 0)
-        return i+1;
-    }
-  }
-  if (cycles) {
-    l = cubiclength(n-1,goal);
-    if (l < 0)
-      return -l+n-1;
-    if (cached_length > 0 && cached_length != L+l) {
-      reportError("arclength != length.\n"
-                  "path3::arclength(double) must have broken semantics.\n"
-                  "Please report this error.");
-    }
-    cached_length = L += l;
-    goal -= l;
-    return arctime(goal)+n;
-  }
-  else {
-    cached_length = L;
-    return length();
+  // Locate the first knot at which the goal is attained.
+  Int i=std::lower_bound(L,L+len+1,goal,[base](double l, double goal) {
+      return l-base < goal;})-L;
+  if(i == 0 || L[i]-base == goal) return i;
+  --i;
+  double l=cubiclength(i,goal-(L[i]-base));
+  return l < 0 ? i-l : i+1;
+}
+
+void path3::arctime(double *t, const double *l, size_t m) const
+{
+  const double *L=arclengths();
+  double *temp=NULL;
+  if(!L) {
+    temp=new double[length()+1];
+    measure(temp);
+    L=temp;
   }
+  for(size_t i=0; i < m; ++i)
+    t[i]=arctime(L,l[i]);
+  delete[] temp;
+}
+
+double path3::arctime(double goal) const
+{
+  double t;
+  arctime(&t,&goal,1);
+  return t;
 }
 
 // }}}
@@ -587,6 +740,87 @@ void add(double& s, double& t, std::vector<double>& S, std::vector<double>& T,
   }
 }
 
+// Path3s with more than this many segments in total are intersected
+// segment by segment after pruning pairs with disjoint bounding boxes.
+static const Int sweepsegments=16;
+
+// The bounding box of the control polygon of segment i of path3 p or q.
+struct segmentBox3 {
+  bbox3 box;
+  Int i;
+  bool q;
+  segmentBox3(const path3& g, Int i, bool q, double fuzz) : i(i), q(q) {
+    box=bbox3(g.point(i));
+    box.add(g.postcontrol(i));
+    box.add(g.precontrol(i+1));
+    box.add(g.point(i+1));
+    // Allow for the fuzz on the segments of one path3 only.
+    if(!q) {
+      box.left -= fuzz;
+      box.bottom -= fuzz;
+      box.near -= fuzz;
+      box.right += fuzz;
+      box.top += fuzz;
+      box.far += fuzz;
+    }
+  }
+  bool operator < (const segmentBox3& b) const {return box.left < b.box.left;}
+};
+
+// Find all intersections of p and q by sweeping the segment bounding boxes
+// along the x axis, intersecting only those pairs of segments whose boxes
+// overlap.
+static bool sweepintersections(std::vector<double>& S, std::vector<double>& T,
+                               path3& p, path3& q, double fuzz, bool exact,
+                               unsigned depth)
+{
+  double fuzz2=max(fuzzFactor*fuzz*fuzz,Fuzz2);
+  Int lp=p.length();
+  Int lq=q.length();
+
+  std::vector<segmentBox3> boxes;
+  boxes.reserve(lp+lq);
+  for(Int i=0; i < lp; ++i)
+    boxes.push_back(segmentBox3(p,i,false,fuzz));
+  for(Int j=0; j < lq; ++j)
+    boxes.push_back(segmentBox3(q,j,true,fuzz));
+  sort(boxes.begin(),boxes.end());
+
+  std::vector<std::pair<Int,Int> > candidates;
+  std::vector<const segmentBox3 *> active[2];
+  for(size_t k=0; k < boxes.size(); ++k) {
+    const segmentBox3& b=boxes[k];
+    std::vector<const segmentBox3 *>& other=active[!b.q];
+    size_t m=0;
+    for(size_t l=0; l < other.size(); ++l) {
+      const segmentBox3 *a=other[l];
+      if(a->box.right < b.box.left) continue; // Retire a.
+      other[m++]=a;
+      if(a->box.top >= b.box.bottom && b.box.top >= a->box.bottom &&
+         a->box.far >= b.box.near && b.box.far >= a->box.near)
+        candidates.push_back(b.q ? std::make_pair(a->i,b.i) :
+                             std::make_pair(b.i,a->i));
+    }
+    other.resize(m);
+    active[b.q].push_back(&b);
+  }
+  sort(candidates.begin(),candidates.end());
+
+  double s,t;
+  std::vector<double> S1,T1;
+  for(size_t k=0; k < candidates.size(); ++k) {
+    Int i=candidates[k].first;
+    Int j=candidates[k].second;
+    path3 pi=p.subpath(i,i+1);
+    path3 qj=q.subpath(j,j+1);
+    S1.clear();
+    T1.clear();
+    if(intersections(s,t,S1,T1,pi,qj,fuzz,false,exact,depth))
+      add(s,t,S,T,S1,T1,1.0,1.0,i,j,p,q,fuzz2,false);
+  }
+  return S.size() > 0;
+}
+
 bool intersections(double &s, double &t, std::vector<double>& S,
                    std::vector<double>& T, path3& p, path3& q,
                    double fuzz, bool single, bool exact, unsigned depth)
@@ -638,6 +872,9 @@ bool intersections(double &s, double &t, std::vector<double>& S,
       return true;
     }
 
+    if(!single && lp > 0 && lq > 0 && lp+lq > sweepsegments)
+      return sweepintersections(S,T,p,q,fuzz,exact,depth);
+
     path3 p1,p2;
     double pscale,poffset;
 
@@ -739,7 +976,7 @@ path3 concat(const path3& p1, const path3& p2)
   triple a=p1.point(n1);
   triple b=p2.point((Int) 0);
 
-  mem::vector<solvedKnot3> nodes(n1+n2+1);
+  solvedKnot3 *nodes=path3::allocate(n1+n2+1);
 
   Int i = 0;
   nodes[0].pre = p1.point((Int) 0);
@@ -765,7 +1002,7 @@ path3 concat(const path3& p1, const path3& p2)
 path3 transformed(const array& t, const path3& p)
 {
   Int n = p.size();
-  mem::vector<solvedKnot3> nodes(n);
+  solvedKnot3 *nodes=path3::allocate(n);
 
   for (Int i = 0; i < n; ++i) {
     nodes[i].pre = t * p.precontrol(i);
@@ -780,7 +1017,7 @@ path3 transformed(const array& t, const path3& p)
 path3 transformed(const double* t, const path3& p)
 {
   Int n = p.size();
-  mem::vector<solvedKnot3> nodes(n);
+  solvedKnot3 *nodes=path3::allocate(n);
 
   for(Int i=0; i < n; ++i) {
     nodes[i].pre=t*p.precontrol(i);
@@ -10,6 +10,7 @@
 #define PATH3_H
 
 #include <cfloat>
+#include <algorithm>
 
 #include "mod.h"
 #include "triple.h"
@@ -41,62 +42,116 @@ struct solvedKnot3 : public gc {
 
 class path3 : public gc {
   bool cycles;  // If the path3 is closed in a loop
+  bool view;    // If the path3 is a subpath sharing the knots of another path3
 
   Int n; // The number of knots
 
-  mem::vector<solvedKnot3> nodes;
+  // Since path3s are immutable, the knots are shared by all copies of a
+  // path3 and by subpaths that are contiguous runs of its knots, along with
+  // the arclength table. The storage is kept so that the collector can
+  // find it.
+  knotStorage<solvedKnot3> *storage;
+  const solvedKnot3 *nodes;
   mutable double cached_length; // Cache length since path3 is immutable.
 
   mutable bbox3 box;
   mutable bbox3 times; // Times where minimum and maximum extents are attained.
 
+  // A view of the knots start,...,start+n-1 of the noncyclic path3 p.
+  path3(const path3& p, Int start, Int n)
+    : cycles(false), view(true), n(n), storage(p.storage),
+      nodes(p.nodes+start), cached_length(-1) {}
+
+  // Store the cumulative arclengths of the segments in L[0],...,L[length()].
+  void measure(double *L) const;
+
+  // Return the arclength table kept with the storage, starting at the first
+  // knot; for a view, the entries are offset by L[0].
+  const double *arclengths() const;
+
+  // Return the arctime of goal, given a table L from arclengths().
+  double arctime(const double *L, double goal) const;
+
 public:
+  // Allocate storage for n knots, to be filled in and passed to the
+  // constructor below.
+  static solvedKnot3 *allocate(Int n) {
+    return knotStorage<solvedKnot3>::allocate(n);
+  }
+
   path3()
-    : cycles(false), n(0), nodes(), cached_length(-1) {}
+    : cycles(false), view(false), n(0), storage(NULL), nodes(NULL),
+      cached_length(-1) {}
 
   // Create a path3 of a single point
   path3(triple z, bool = false)
-    : cycles(false), n(1), nodes(1), cached_length(-1)
+    : cycles(false), view(false), n(1), cached_length(-1)
   {
-    nodes[0].pre = nodes[0].point = nodes[0].post = z;
-    nodes[0].straight = false;
+    solvedKnot3 *knots=allocate(1);
+    knots[0].pre = knots[0].point = knots[0].post = z;
+    knots[0].straight = false;
+    storage=knotStorage<solvedKnot3>::of(knots);
+    nodes=knots;
   }
 
   // Creates path3 from a list of knots.  This will be used by camp
   // methods such as the guide solver, but should probably not be used by a
   // user of the system unless he knows what he is doing.
-  path3(mem::vector<solvedKnot3>& nodes, Int n, bool cycles = false)
-    : cycles(cycles), n(n), nodes(nodes), cached_length(-1)
+  path3(const mem::vector<solvedKnot3>& nodes, Int n, bool cycles = false)
+    : cycles(cycles), view(false), n(n), cached_length(-1)
   {
+    solvedKnot3 *knots=allocate(n);
+    std::copy(nodes.begin(),nodes.begin()+n,knots);
+    storage=knotStorage<solvedKnot3>::of(knots);
+    this->nodes=knots;
   }
 
+  // Creates path3 from knots obtained from allocate(), which must not be
+  // modified afterwards.
+  path3(const solvedKnot3 *nodes, Int n, bool cycles = false)
+    : cycles(cycles), view(false), n(n),
+      storage(knotStorage<solvedKnot3>::of(nodes)), nodes(nodes),
+      cached_length(-1) {}
+
   friend bool operator== (const path3& p, const path3& q)
   {
-    return p.cycles == q.cycles && p.nodes == q.nodes;
+    if(p.cycles != q.cycles || p.n != q.n) return false;
+    for(Int i=0; i < p.n; ++i)
+      if(p.precontrol(i) != q.precontrol(i) || p.point(i) != q.point(i) ||
+         p.postcontrol(i) != q.postcontrol(i)) return false;
+    return true;
   }
 
 public:
   path3(solvedKnot3 n1, solvedKnot3 n2)
-    : cycles(false), n(2), nodes(2), cached_length(-1)
+    : cycles(false), view(false), n(2), cached_length(-1)
   {
-    nodes[0] = n1;
-    nodes[1] = n2;
-    nodes[0].pre = nodes[0].point;
-    nodes[1].post = nodes[1].point;
+    solvedKnot3 *knots=allocate(2);
+    knots[0] = n1;
+    knots[1] = n2;
+    knots[0].pre = knots[0].point;
+    knots[1].post = knots[1].point;
+    storage=knotStorage<solvedKnot3>::of(knots);
+    nodes=knots;
   }
 
-  // Copy constructor
+  // Copy constructor: the knots are shared.
   path3(const path3& p)
-    : cycles(p.cycles), n(p.n), nodes(p.nodes), cached_length(p.cached_length),
-      box(p.box), times(p.times)
+    : cycles(p.cycles), view(p.view), n(p.n), storage(p.storage),
+      nodes(p.nodes), cached_length(p.cached_length), box(p.box),
+      times(p.times)
   {}
 
   path3 unstraighten() const
   {
-    path3 P=path3(*this);
-    for(int i=0; i < n; ++i)
-      P.nodes[i].straight=false;
-    return P;
+    solvedKnot3 *knots=allocate(n);
+    for(Int i=0; i < n; ++i) {
+      knots[i].pre=precontrol(i);
+      knots[i].point=nodes[i].point;
+      knots[i].post=postcontrol(i);
+      knots[i].straight=false;
+    }
+    return path3(knots,n,cycles);
   }
 
   virtual ~path3()
@@ -124,7 +179,7 @@ public:
     return cycles;
   }
 
-  mem::vector<solvedKnot3>& Nodes() {
+  const solvedKnot3 *Nodes() const {
     return nodes;
   }
 
@@ -149,16 +204,22 @@ public:
 
   triple point(double t) const;
 
+  // Store in z[i] the point at time t[i], for i=0,...,m-1.
+  void point(triple *z, const double *t, size_t m) const;
+
+  // The end controls of a view are clamped to the endpoints.
   triple precontrol(Int t) const
   {
-    return nodes[adjustedIndex(t,n,cycles)].pre;
+    Int i=adjustedIndex(t,n,cycles);
+    return view && i == 0 ? nodes[i].point : nodes[i].pre;
   }
 
   triple precontrol(double t) const;
 
   triple postcontrol(Int t) const
   {
-    return nodes[adjustedIndex(t,n,cycles)].post;
+    Int i=adjustedIndex(t,n,cycles);
+    return view && i == n-1 ? nodes[i].point : nodes[i].post;
   }
 
   triple postcontrol(double t) const;
@@ -232,6 +293,9 @@ public:
     return unit(a);
   }
 
+  // Store in z[i] the direction at time t[i], for i=0,...,m-1.
+  void dir(triple *z, const double *t, size_t m, bool normalize=true) const;
+
   triple postaccel(Int t) const {
     if(!cycles && t >= n-1) return triple(0,0,0);
     triple z0=point(t);
@@ -270,6 +334,9 @@ public:
     return 6.0*t*(z1-z0+3.0*(c0-c1))+6.0*(z0+c1)-12.0*c0;
   }
 
+  // Store in z[i] the acceleration at time t[i], for i=0,...,m-1.
+  void accel(triple *z, const double *t, size_t m) const;
+
   // Returns the path3 traced out in reverse.
   path3 reverse() const;
 
@@ -304,6 +371,8 @@ public:
   double cubiclength(Int i, double goal=-1) const;
   double arclength () const;
   double arctime (double l) const;
+  // Store in t[i] the arctimes of the m arclengths l[i].
+  void arctime(double *t, const double *l, size_t m) const;
 
   triple max() const {
     checkEmpty3(n);
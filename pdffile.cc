@@ -0,0 +1,598 @@
+/*****
+ * pdffile.cc
+ *
+ * Write a picture directly to a single-page PDF file, bypassing the
+ * conversion of PostScript output by Ghostscript.
+ *
+ * The page content is accumulated with the PDF operators that psfile already
+ * emits in pdf mode; images, shadings, and graphics states are written as
+ * separate objects as they are encountered and listed as page resources.
+ *****/
+
+#include <cstdio>
+#include <ctime>
+#include <locale>
+
+#include "pdffile.h"
+#include "settings.h"
+#include "errormsg.h"
+
+using std::ofstream;
+using vm::array;
+using vm::read;
+
+namespace camp {
+
+namespace {
+
+const char *inconsistent="inconsistent colorspaces";
+const char *rectangular="matrix is not rectangular";
+
+// Format reals as PDF requires, without an exponent.
+class pdfnumput : public std::num_put<char> {
+protected:
+  iter_type do_put(iter_type s, std::ios_base& f, char_type fill,
+                   double x) const {
+    char buf[32];
+    int precision=(int) f.precision();
+    bool Fixed=(f.flags() & std::ios::floatfield) == std::ios::fixed;
+    size_t n=formatReal(buf,x,precision,Fixed);
+    if(n > 0) return std::copy(buf,buf+n,s);
+
+    std::ostringstream out;
+    out.precision(precision);
+    if(Fixed) out.setf(std::ios::fixed);
+    out << x;
+    string r=out.str();
+    if(!Fixed && r.find('e') != string::npos) {
+      out.str("");
+      out << std::fixed << x;
+      r=out.str();
+      if(r.find('.') != string::npos) {
+        r.erase(r.find_last_not_of('0')+1);
+        if(r[r.size()-1] == '.') r.erase(r.size()-1);
+      }
+    }
+    return std::copy(r.begin(),r.end(),s);
+  }
+
+  iter_type do_put(iter_type s, std::ios_base& f, char_type fill,
+                   long double x) const {
+    return do_put(s,f,fill,(double) x);
+  }
+};
+
+// Write binary data directly to a stream.
+class rawbytes : public bytestream {
+  ostream *out;
+public:
+  rawbytes(ostream *out) : out(out) {}
+  void put(const unsigned char *a, size_t n) {
+    out->write((const char *) a,n);
+  }
+};
+
+// Does p have the same color as q?
+bool samecolor(const pen& p, const pen& q)
+{
+  if(p.cmyk())
+    return q.cmyk() && p.cyan() == q.cyan() && p.magenta() == q.magenta() &&
+      p.yellow() == q.yellow() && p.black() == q.black();
+  if(p.rgb())
+    return q.rgb() && p.red() == q.red() && p.green() == q.green() &&
+      p.blue() == q.blue();
+  if(p.grayscale())
+    return q.grayscale() && p.gray() == q.gray();
+  return true;
+}
+
+// The data of a type 4 or 7 mesh shading, with 32-bit coordinates relative
+// to the bounding box b and 16-bit color components.
+class mesh {
+  std::vector<unsigned char> data;
+  bbox b;
+  double sx,sy;
+
+  void put(unsigned int v, int bytes) {
+    while(bytes-- > 0)
+      data.push_back((v >> 8*bytes) & 0xff);
+  }
+
+  unsigned int coordinate(double u) {
+    return (unsigned int) (min(max(u,0.0),1.0)*4294967295.0+0.5);
+  }
+
+public:
+  mesh(const bbox& B) : b(B) {
+    if(b.right == b.left) b.right=b.left+1.0;
+    if(b.top == b.bottom) b.top=b.bottom+1.0;
+    sx=1.0/(b.right-b.left);
+    sy=1.0/(b.top-b.bottom);
+  }
+
+  void flag(Int f) {put(f,1);}
+
+  void point(const pair& z) {
+    put(coordinate((z.getx()-b.left)*sx),4);
+    put(coordinate((z.gety()-b.bottom)*sy),4);
+  }
+
+  void color(pen *p, ColorSpace colorspace) {
+    p->convert();
+    if(!p->promote(colorspace))
+      reportError(inconsistent);
+    double c[4];
+    size_t n=0;
+    if(p->cmyk()) {
+      c[n++]=p->cyan(); c[n++]=p->magenta(); c[n++]=p->yellow();
+      c[n++]=p->black();
+    } else if(p->rgb()) {
+      c[n++]=p->red(); c[n++]=p->green(); c[n++]=p->blue();
+    } else if(p->grayscale())
+      c[n++]=p->gray();
+    for(size_t i=0; i < n; ++i)
+      put((unsigned int) (c[i]*65535.0+0.5),2);
+  }
+
+  // Write the entries of the shading dictionary that describe the data.
+  void dict(ostream& out, size_t ncomponents) {
+    out << "/BitsPerCoordinate 32" << newl
+        << "/BitsPerComponent 16" << newl
+        << "/BitsPerFlag 8" << newl
+        << "/Decode [" << b.left << " " << b.right << " "
+        << b.bottom << " " << b.top;
+    for(size_t i=0; i < ncomponents; ++i)
+      out << " 0 1";
+    out << "]" << newl;
+  }
+
+  const unsigned char *bytes() {return data.data();}
+  size_t size() {return data.size();}
+};
+
+}
+
+pdffile::pdffile(const string& filename)
+  : psfile(filename,true), compress(settings::getSetting<bool>("compress")),
+    transparency(false), imagecolorspace(DEFCOLOR)
+{
+  pdf=true;
+  if(!filename.empty()) {
+    delete out;
+    out=new ofstream(filename.c_str(),std::ios::binary);
+    out->setf(std::ios::boolalpha);
+    if(!*out)
+      reportError("Cannot write to "+filename);
+  }
+  std::locale locale(out->getloc(),new pdfnumput);
+  out->imbue(locale);
+  content.imbue(locale);
+  content.setf(std::ios::boolalpha);
+  pathdata.imbue(locale);
+  file=out;
+  out=&content;
+  offsets.push_back(0); // Object 0 heads the list of free objects.
+}
+
+pdffile::~pdffile()
+{
+  // Let psfile close the file if epilogue was never reached.
+  if(out == &content) out=file;
+}
+
+void pdffile::writepath()
+{
+  content << pathdata.str();
+  pathdata.str("");
+}
+
+void pdffile::moveto(pair z)
+{
+  out=&pathdata;
+  psfile::moveto(z);
+  out=&content;
+}
+
+void pdffile::lineto(pair z)
+{
+  out=&pathdata;
+  psfile::lineto(z);
+  out=&content;
+}
+
+void pdffile::curveto(pair zp, pair zm, pair z1)
+{
+  out=&pathdata;
+  psfile::curveto(zp,zm,z1);
+  out=&content;
+}
+
+void pdffile::closepath()
+{
+  out=&pathdata;
+  psfile::closepath();
+  out=&content;
+}
+
+void pdffile::stroke(const pen &p, bool dot)
+{
+  writepath();
+  psfile::stroke(p,dot);
+}
+
+void pdffile::fill(const pen &p)
+{
+  writepath();
+  psfile::fill(p);
+}
+
+void pdffile::endclip(const pen &p)
+{
+  writepath();
+  psfile::endclip(p);
+}
+
+size_t pdffile::newobject()
+{
+  offsets.push_back(0);
+  return offsets.size()-1;
+}
+
+void pdffile::beginobject(size_t i)
+{
+  offsets[i]=file->tellp();
+  out=file;
+  *out << i << " 0 obj" << newl;
+}
+
+void pdffile::endobject()
+{
+  *out << "endobj" << newl;
+  out=&content;
+}
+
+void pdffile::stream(const unsigned char *data, size_t size)
+{
+  if(compress) {
+    // The compressed size is only known afterwards, so refer to it.
+    size_t length=newobject();
+    *out << "/Filter /FlateDecode" << newl
+         << "/Length " << length << " 0 R" << newl
+         << ">>" << newl
+         << "stream" << newl;
+    rawbytes s(out);
+    lengths.push_back(std::make_pair(length,deflateblocks(s,data,size)));
+  } else {
+    *out << "/Length " << size << newl
+         << ">>" << newl
+         << "stream" << newl;
+    out->write((const char *) data,size);
+  }
+  *out << newl << "endstream" << newl;
+}
+
+void pdffile::shade(size_t i)
+{
+  shadings.push_back(i);
+  *out << "/Sh" << i << " sh" << newl;
+}
+
+void pdffile::resources(const string& type, const string& prefix,
+                        const mem::vector<size_t>& objects)
+{
+  size_t n=objects.size();
+  if(n == 0) return;
+  *out << "/" << type << " <<";
+  for(size_t i=0; i < n; ++i)
+    *out << " /" << prefix << objects[i] << " " << objects[i] << " 0 R";
+  *out << " >>" << newl;
+}
+
+void pdffile::prologue(const bbox& b)
+{
+  box=b;
+  *file << "%PDF-1.4" << newl
+        << "%\342\343\317\323" << newl;
+}
+
+void pdffile::epilogue()
+{
+  string s=content.str();
+  size_t contents=beginobject();
+  *out << "<<" << newl;
+  stream((const unsigned char *) s.data(),s.size());
+  endobject();
+
+  size_t pages=newobject();
+  size_t page=beginobject();
+  *out << "<< /Type /Page" << newl
+       << "/Parent " << pages << " 0 R" << newl
+       << "/MediaBox [" << box << "]" << newl
+       << "/Contents " << contents << " 0 R" << newl
+       << "/Resources <<" << newl;
+  resources("ExtGState","GS",gstates);
+  resources("Shading","Sh",shadings);
+  resources("XObject","Im",xobjects);
+  *out << ">>" << newl;
+  if(transparency)
+    *out << "/Group << /Type /Group /S /Transparency /CS /DeviceRGB >>"
+         << newl;
+  *out << ">>" << newl;
+  endobject();
+
+  beginobject(pages);
+  *out << "<< /Type /Pages /Kids [" << page << " 0 R] /Count 1 >>" << newl;
+  endobject();
+
+  size_t catalog=beginobject();
+  *out << "<< /Type /Catalog /Pages " << pages << " 0 R >>" << newl;
+  endobject();
+
+  time_t t; time(&t);
+  char date[32];
+  strftime(date,sizeof(date),"D:%Y%m%d%H%M%S",localtime(&t));
+  size_t info=beginobject();
+  *out << "<< /Producer (" << settings::PROGRAM << " " << settings::VERSION
+       << REVISION << ")" << newl
+       << "/CreationDate (" << date << ") >>" << newl;
+  endobject();
+
+  for(size_t i=0; i < lengths.size(); ++i) {
+    beginobject(lengths[i].first);
+    *out << lengths[i].second << newl;
+    endobject();
+  }
+
+  out=file;
+  std::streamoff xref=out->tellp();
+  size_t n=offsets.size();
+  *out << "xref" << newl
+       << "0 " << n << newl
+       << "0000000000 65535 f " << newl;
+  for(size_t i=1; i < n; ++i) {
+    char entry[32];
+    snprintf(entry,sizeof(entry),"%010lld 00000 n ",(long long) offsets[i]);
+    *out << entry << newl;
+  }
+  *out << "trailer" << newl
+       << "<< /Size " << n << " /Root " << catalog << " 0 R /Info " << info
+       << " 0 R >>" << newl
+       << "startxref" << newl
+       << xref << newl
+       << "%%EOF" << newl;
+}
+
+void pdffile::setopacity(const pen& p)
+{
+  double opacity=p.opacity();
+  string blend=p.blend();
+  if(opacity != lastpen.opacity() || blend != lastpen.blend()) {
+    std::pair<double,string> key(opacity,blend);
+    gstatemap::iterator q=gstate.find(key);
+    size_t i;
+    if(q == gstate.end()) {
+      i=beginobject();
+      *out << "<< /Type /ExtGState /ca " << opacity << " /CA " << opacity
+           << " /BM /" << blend << " >>" << newl;
+      endobject();
+      gstate[key]=i;
+      gstates.push_back(i);
+    } else i=q->second;
+    *out << "/GS" << i << " gs" << newl;
+    if(opacity < 1.0 || (blend != "Normal" && blend != "Compatible"))
+      transparency=true;
+  }
+
+  lastpen.settransparency(p);
+}
+
+void pdffile::setpen(pen p)
+{
+  p.convert();
+
+  setopacity(p);
+
+  if(!samecolor(p,lastpen)) {
+    string op=p.cmyk() ? "k" : p.rgb() ? "rg" : "g";
+    string OP=p.cmyk() ? "K" : p.rgb() ? "RG" : "G";
+    write(p);
+    *out << " " << op << " ";
+    write(p);
+    *out << " " << OP << newl;
+  }
+
+  if(p.width() != lastpen.width())
+    *out << p.width() << " w" << newl;
+
+  if(p.cap() != lastpen.cap())
+    *out << p.cap() << " J" << newl;
+
+  if(p.join() != lastpen.join())
+    *out << p.join() << " j" << newl;
+
+  if(p.miter() != lastpen.miter())
+    *out << p.miter() << " M" << newl;
+
+  const LineType *linetype=p.linetype();
+  const LineType *lastlinetype=lastpen.linetype();
+
+  if(!(linetype->pattern == lastlinetype->pattern) ||
+     linetype->offset != lastlinetype->offset)
+    *out << linetype->pattern << " " << linetype->offset << " d" << newl;
+
+  lastpen=p;
+}
+
+void pdffile::imageheader(size_t width, size_t height, ColorSpace colorspace)
+{
+  imagecolorspace=colorspace;
+}
+
+void pdffile::outImage(bool antialias, size_t width, size_t height,
+                       size_t ncomponents)
+{
+  if(antialias) dealias(buffer,width,height,ncomponents);
+
+  size_t i=beginobject();
+  *out << "<< /Type /XObject" << newl
+       << "/Subtype /Image" << newl
+       << "/Width " << width << newl
+       << "/Height " << height << newl
+       << "/ColorSpace /Device" << ColorDeviceSuffix[imagecolorspace] << newl
+       << "/BitsPerComponent 8" << newl;
+  stream(buffer,count);
+  endobject();
+
+  xobjects.push_back(i);
+  // Unlike PostScript images, PDF images begin with the top row.
+  *out << "q 1 0 0 -1 0 1 cm /Im" << i << " Do Q" << newl;
+}
+
+void pdffile::latticeshade(const array& a, const transform& t)
+{
+  size_t n=a.size();
+  if(n == 0) return;
+
+  array *a0=read<array *>(a,0);
+  size_t m=a0->size();
+  setfirstopacity(*a0);
+
+  ColorSpace colorspace=maxcolorspace2(a);
+  checkColorSpace(colorspace);
+
+  size_t ncomponents=ColorComponents[colorspace];
+
+  beginImage(ncomponents*m*n);
+  for(size_t i=n; i > 0;) {
+    array *ai=read<array *>(a,--i);
+    checkArray(ai);
+    size_t aisize=ai->size();
+    if(aisize != m) reportError(rectangular);
+    for(size_t j=0; j < m; j++) {
+      pen *p=read<pen *>(ai,j);
+      p->convert();
+      if(!p->promote(colorspace))
+        reportError(inconsistent);
+      write(p,ncomponents);
+    }
+  }
+
+  size_t f=beginobject();
+  *out << "<< /FunctionType 0" << newl
+       << "/Domain [0 1 0 1]" << newl
+       << "/Range [";
+  for(size_t i=0; i < ncomponents; ++i)
+    *out << "0 1 ";
+  *out << "]" << newl
+       << "/BitsPerSample 8" << newl
+       << "/Size [" << m << " " << n << "]" << newl;
+  stream(buffer,count);
+  endobject();
+  delete[] buffer;
+
+  size_t i=beginobject();
+  *out << "<< /ShadingType 1" << newl
+       << "/Matrix [";
+  write(t);
+  *out << "]" << newl
+       << "/ColorSpace /Device" << ColorDeviceSuffix[colorspace] << newl
+       << "/Function " << f << " 0 R" << newl
+       << ">>" << newl;
+  endobject();
+  shade(i);
+}
+
+void pdffile::gradientshade(bool axial, ColorSpace colorspace,
+                            const pen& pena, const pair& a, double ra,
+                            bool extenda, const pen& penb, const pair& b,
+                            double rb, bool extendb)
+{
+  setopacity(pena);
+  checkColorSpace(colorspace);
+
+  size_t i=beginobject();
+  gradientdict(axial,colorspace,pena,a,ra,extenda,penb,b,rb,extendb);
+  endobject();
+  shade(i);
+}
+
+void pdffile::gouraudshade(const pen& pentype, const array& pens,
+                           const array& vertices, const array& edges)
+{
+  size_t size=pens.size();
+  if(size == 0) return;
+
+  setfirstopacity(pens);
+  ColorSpace colorspace=maxcolorspace(pens);
+  checkColorSpace(colorspace);
+
+  bbox b;
+  for(size_t i=0; i < size; i++)
+    b += read<pair>(vertices,i);
+
+  mesh data(b);
+  for(size_t i=0; i < size; i++) {
+    data.flag(read<Int>(edges,i));
+    data.point(read<pair>(vertices,i));
+    data.color(read<pen *>(pens,i),colorspace);
+  }
+
+  size_t i=beginobject();
+  *out << "<< /ShadingType 4" << newl
+       << "/ColorSpace /Device" << ColorDeviceSuffix[colorspace] << newl;
+  data.dict(*out,ColorComponents[colorspace]);
+  stream(data.bytes(),data.size());
+  endobject();
+  shade(i);
+}
+
+void pdffile::tensorshade(const pen& pentype, const array& pens,
+                          const array& boundaries, const array& z)
+{
+  size_t size=pens.size();
+  if(size == 0) return;
+  size_t nz=z.size();
+
+  array *p0=read<array *>(pens,0);
+  if(checkArray(p0) != 4)
+    reportError("4 pens required");
+  setfirstopacity(*p0);
+
+  ColorSpace colorspace=maxcolorspace2(pens);
+  checkColorSpace(colorspace);
+
+  std::vector<pair> Z(16*size);
+  bbox b;
+  for(size_t i=0; i < size; i++) {
+    pair *Zi=&Z[16*i];
+    tensorpoints(Zi,read<path>(boundaries,i),
+                 nz == 0 ? NULL : read<array *>(z,i));
+    for(size_t j=0; j < 16; ++j)
+      b += Zi[j];
+  }
+
+  mesh data(b);
+  for(size_t i=0; i < size; i++) {
+    // As for PostScript, only edge flag 0 (new patch) is used.
+    data.flag(0);
+    for(size_t j=0; j < 16; ++j)
+      data.point(Z[16*i+j]);
+    array *pi=read<array *>(pens,i);
+    if(checkArray(pi) != 4)
+      reportError("specify 4 pens for each path");
+    data.color(read<pen *>(pi,0),colorspace);
+    data.color(read<pen *>(pi,3),colorspace);
+    data.color(read<pen *>(pi,2),colorspace);
+    data.color(read<pen *>(pi,1),colorspace);
+  }
+
+  size_t i=beginobject();
+  *out << "<< /ShadingType 7" << newl
+       << "/ColorSpace /Device" << ColorDeviceSuffix[colorspace] << newl;
+  data.dict(*out,ColorComponents[colorspace]);
+  stream(data.bytes(),data.size());
+  endobject();
+  shade(i);
+}
+
+} //namespace camp
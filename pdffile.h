@@ -0,0 +1,101 @@
+/*****
+ * pdffile.h
+ *
+ * Write a picture directly to a single-page PDF file, bypassing the
+ * conversion of PostScript output by Ghostscript.
+ *****/
+
+#ifndef PDFFILE_H
+#define PDFFILE_H
+
+#include "psfile.h"
+
+namespace camp {
+
+class pdffile : public psfile {
+  std::ostream *file;          // The PDF file; out holds the page content.
+  std::ostringstream content;
+  std::ostringstream pathdata; // Path under construction.
+  bbox box;
+  bool compress;
+  bool transparency;           // Does the page need a transparency group?
+
+  mem::vector<std::streamoff> offsets;  // File offset of each object.
+  mem::vector<size_t> gstates;
+  mem::vector<size_t> shadings;
+  mem::vector<size_t> xobjects;
+
+  // Objects holding the lengths of compressed streams.
+  mem::vector<std::pair<size_t,size_t> > lengths;
+
+  typedef mem::map<std::pair<double,string>,size_t> gstatemap;
+  gstatemap gstate;
+
+  ColorSpace imagecolorspace;
+
+  // Reserve an object number.
+  size_t newobject();
+
+  // Begin writing object i, or a new object, to the file.
+  void beginobject(size_t i);
+  size_t beginobject() {
+    size_t i=newobject();
+    beginobject(i);
+    return i;
+  }
+  void endobject();
+
+  // Close the dictionary of the current object with the given stream data.
+  void stream(const unsigned char *data, size_t size);
+
+  // PDF forbids state changes between path construction and painting, so
+  // buffer the path until it is painted.
+  void writepath();
+
+  // Paint the shading defined by the object i.
+  void shade(size_t i);
+
+  // List the given objects in the page resource dictionary of the given type.
+  void resources(const string& type, const string& prefix,
+                 const mem::vector<size_t>& objects);
+
+public:
+  pdffile(const string& filename);
+  ~pdffile();
+
+  void prologue(const bbox& box);
+  void epilogue();
+
+  void setopacity(const pen& p);
+  void setpen(pen p);
+
+  void moveto(pair z);
+  void lineto(pair z);
+  void curveto(pair zp, pair zm, pair z1);
+  void closepath();
+
+  void stroke(const pen &p, bool dot=false);
+  void fill(const pen &p);
+  void endclip(const pen &p);
+
+  void imageheader(size_t width, size_t height, ColorSpace colorspace);
+  void outImage(bool antialias, size_t width, size_t height,
+                size_t ncomponents);
+
+  void latticeshade(const vm::array& a, const transform& t);
+
+  void gradientshade(bool axial, ColorSpace colorspace,
+                     const pen& pena, const pair& a, double ra,
+                     bool extenda, const pen& penb, const pair& b,
+                     double rb, bool extendb);
+
+  void gouraudshade(const pen& pentype, const vm::array& pens,
+                    const vm::array& vertices, const vm::array& edges);
+
+  void tensorshade(const pen& pentype, const vm::array& pens,
+                   const vm::array& boundaries, const vm::array& z);
+};
+
+} //namespace camp
+
+#endif
@@ -16,6 +16,9 @@
 #include "drawlayer.h"
 #include "drawsurface.h"
 #include "drawpath3.h"
+#include "pdffile.h"
+#include "ghostscript.h"
+#include "timing.h"
 
 #ifdef __MSDOS__
 #include "sys/cygwin.h"
@@ -263,6 +266,16 @@ bool picture::havenewpage()
   return false;
 }
 
+bool picture::nativepdf()
+{
+  for(nodelist::iterator p=nodes.begin(); p != nodes.end(); ++p) {
+    assert(*p);
+    if(!(*p)->nativepdf())
+      return false;
+  }
+  return true;
+}
+
 bbox picture::bounds()
 {
   size_t n=nodes.size();
@@ -344,13 +357,23 @@ pair picture::ratio(double (*m)(double, double))
   return b;
 }
 
+// Wait for the background shipouts that the TeX preamble might read.
+void waitShipoutsReadBy(const mem::list<string>& preamble)
+{
+  for(mem::list<string>::const_iterator p=preamble.begin();
+      p != preamble.end(); ++p)
+    waitShipoutsReadBy(*p);
+}
+
 void texinit()
 {
+  timing::timer timer(timing::LABELS);
   drawElement::lastpen=pen(initialpen);
   processDataStruct &pd=processData();
   // Output any new texpreamble commands
   if(pd.tex.isopen()) {
     if(pd.TeXpipepreamble.empty()) return;
+    waitShipoutsReadBy(pd.TeXpipepreamble);
     texpreamble(pd.tex,pd.TeXpipepreamble,true);
     pd.TeXpipepreamble.clear();
     return;
@@ -398,6 +421,7 @@ void texinit()
   pd.tex << "\n";
   texdocumentclass(pd.tex,true);
 
+  waitShipoutsReadBy(pd.TeXpreamble);
   texdefines(pd.tex,pd.TeXpreamble,true);
   pd.TeXpipepreamble.clear();
 }
@@ -654,7 +678,7 @@ int picture::epstopdf(const string& epsname, const string& pdfname)
     oldPath=getPath();
     setPath(dir.c_str());
   }
-  int status=System(cmd,0,true,"gs","Ghostscript");
+  int status=Ghostscript(cmd);
   if(oldPath != NULL)
     setPath(oldPath);
   return status;
@@ -682,7 +706,7 @@ int picture::pdftoeps(const string& pdfname, const string& epsname, bool eps)
     oldPath=getPath();
     setPath(dir.c_str());
   }
-  int status=System(cmd,0,true,"gs","Ghostscript");
+  int status=Ghostscript(cmd);
   if(oldPath != NULL)
     setPath(oldPath);
   return status;
@@ -809,7 +833,7 @@ bool picture::postprocess(const string& prename, const string& outname,
         push_split(cmd,getSetting<string>("gsOptions"));
         cmd.push_back("-sOutputFile="+outname);
         cmd.push_back(prename);
-        status=System(cmd,0,true,"gs","Ghostscript");
+        status=Ghostscript(cmd);
       } else if(!svg && !getSetting<bool>("xasy")) {
         double expand=antialias;
         if(expand < 2.0) expand=1.0;
@@ -911,6 +935,90 @@ bool picture::display(const string& outname, const string& outputformat,
   return true;
 }
 
+namespace {
+
+// A shipout whose TeX and conversion stages run in a child process.
+struct shipoutJob {
+  int pid;
+  string prefix;
+  string outname;
+  shipoutJob(int pid, const string& prefix, const string& outname) :
+    pid(pid), prefix(prefix), outname(outname) {}
+};
+
+typedef mem::list<shipoutJob> shipoutQueue;
+shipoutQueue shipoutJobs;
+
+// Nesting depth of picture::shipout; inner shipouts produce files that the
+// outer one needs, so they always run in the foreground.
+int shipoutDepth=0;
+
+struct shipoutGuard {
+  shipoutGuard() {++shipoutDepth;}
+  ~shipoutGuard() {--shipoutDepth;}
+};
+
+// Wait for the oldest job, reporting an error if it failed and report is
+// true. The error names the job's output rather than the unrelated code that
+// waited for it, which carries on; only the exit status records the failure.
+void reapShipout(bool report=true)
+{
+  shipoutJob job=shipoutJobs.front();
+  shipoutJobs.pop_front();
+  int status;
+  while(waitpid(job.pid,&status,0) == -1)
+    if(errno != EINTR) return;
+  if(report && !(WIFEXITED(status) && WEXITSTATUS(status) == 0)) {
+    em.message(nullPos,"");
+    em << "shipout of " << job.outname << " failed";
+    em.sync();
+    em.statusError();
+  }
+}
+
+// Wait, in order of submission, for the jobs up to and including the last
+// one using prefix, so that its files can be safely rewritten.
+void waitShipouts(const string& prefix)
+{
+  size_t n=0, i=0;
+  for(shipoutQueue::iterator p=shipoutJobs.begin(); p != shipoutJobs.end();
+      ++p) {
+    ++i;
+    if(p->prefix == prefix) n=i;
+  }
+  for(; n > 0; --n)
+    reapShipout();
+}
+
+// Start the remaining stages of a shipout in the background, first waiting
+// for the oldest jobs if the limit set by the jobs setting has been reached.
+// Returns the result of fork.
+int forkShipout(const string& prefix, const string& outname)
+{
+  size_t n=(size_t) max(getSetting<Int>("jobs"),(Int) 1);
+  while(shipoutJobs.size() >= n)
+    reapShipout();
+  cout.flush();
+  int pid=fork();
+  if(pid > 0)
+    shipoutJobs.push_back(shipoutJob(pid,prefix,outname));
+  return pid;
+}
+
+}
+
+void waitShipouts(bool report)
+{
+  while(!shipoutJobs.empty())
+    reapShipout(report);
+}
+
+void waitShipoutsReadBy(const string& s)
+{
+  if(s.find('\\') != string::npos)
+    waitShipouts();
+}
+
 string Outname(const string& prefix, const string& outputformat,
                bool standardout, string aux="")
 {
@@ -920,6 +1028,9 @@ string Outname(const string& prefix, const string& outputformat,
 bool picture::shipout(picture *preamble, const string& Prefix,
                       const string& format, bool wait, bool view)
 {
+  shipoutGuard guard;
+  timing::timer timer(timing::OUTPUT);
+  timing::count(timing::SHIPOUTS);
   bool keep=getSetting<bool>("keep");
 
   string aux="";
@@ -952,6 +1063,7 @@ bool picture::shipout(picture *preamble, const string& Prefix,
 
   bool standardout=Prefix == "-";
   string prefix=standardout ? standardprefix : stripExt(Prefix);
+  waitShipouts(prefix);
 
   string preformat=nativeformat();
   bool epsformat=outputformat == "eps";
@@ -965,11 +1077,17 @@ bool picture::shipout(picture *preamble, const string& Prefix,
   }
 
   string outname=Outname(prefix,outputformat,standardout,aux);
-  string epsname=epsformat ? (standardout ? "" : outname) :
-    auxname(prefix,"eps");
 
   bool Labels=labels || TeXmode;
 
+  // Write PDF output directly when neither TeX nor Ghostscript is needed.
+  bool native=outputformat == "pdf" && !Labels && !standardout &&
+    getSetting<bool>("nativepdf") && nativepdf() &&
+    (!preamble || preamble->nativepdf());
+
+  string epsname=epsformat ? (standardout ? "" : outname) :
+    auxname(prefix,native ? "pdf" : "eps");
+
   if(outputformat == "png" && (b.right-b.left < 1.0 || b.top-b.bottom < 1.0))
     empty=true;
 
@@ -977,11 +1095,12 @@ bool picture::shipout(picture *preamble, const string& Prefix,
     bbox b;
     b.left=b.bottom=0;
     b.right=b.top=1;
-    psfile out(epsname,false);
-    out.prologue(b);
-    out.epilogue();
-    out.close();
-    return postprocess(epsname,outname,outputformat,wait,view,false,
+    psfile *out=native ? new pdffile(epsname) : new psfile(epsname,false);
+    out->prologue(b);
+    out->epilogue();
+    out->close();
+    delete out;
+    return postprocess(epsname,outname,outputformat,wait,view,native,
                        epsformat,false);
   }
 
@@ -1029,6 +1148,7 @@ bool picture::shipout(picture *preamble, const string& Prefix,
   if(Labels) {
     texname=TeXmode ? buildname(prefix,"tex") : auxname(prefix,"tex");
     tex=dvi ? new svgtexfile(texname,b) : new texfile(texname,b);
+    waitShipoutsReadBy(processData().TeXpreamble);
     tex->prologue();
   }
 
@@ -1057,7 +1177,8 @@ bool picture::shipout(picture *preamble, const string& Prefix,
     }
     files.push_back(psname);
     if(pdf) files.push_back(pdfname);
-    psfile out(psname,pdfformat);
+    psfile *Out=native ? new pdffile(psname) : new psfile(psname,pdfformat);
+    psfile& out=*Out;
     out.prologue(bshift);
 
     if(!Labels) {
@@ -1165,6 +1286,7 @@ bool picture::shipout(picture *preamble, const string& Prefix,
 
     out.epilogue();
     out.close();
+    delete Out;
 
     if(Labels) {
       tex->resetpen();
@@ -1204,23 +1326,43 @@ bool picture::shipout(picture *preamble, const string& Prefix,
     } else {
       if(Labels) {
         tex->epilogue();
-        if(context) prefix=stripDir(prefix);
-        status=texprocess(texname,dvi ? outname : prename,prefix,
-                          bboxshift,dvi);
         delete tex;
-        if(!keep) {
-          for(mem::list<string>::iterator p=files.begin(); p != files.end();
-              ++p)
-            unlink(p->c_str());
-        }
       }
-      if(status) {
-        if(context) prename=stripDir(prename);
-        status=postprocess(prename,outname,outputformat,wait,
-                           view,pdf && Labels,epsformat,svg);
-        if(pdfformat && !keep) {
-          unlink(auxname(prefix,"m9").c_str());
-          unlink(auxname(prefix,"pbsdat").c_str());
+
+      // Run the external tools in the background when allowed; nested
+      // shipouts and viewed output are processed in the foreground.
+      bool background=getSetting<Int>("jobs") > 0 && shipoutDepth == 1 &&
+        !standardout && !htmlformat && !(settings::view() && view);
+      int pid=background ? forkShipout(prefix,outname) : -1;
+
+      if(pid <= 0) {
+        try {
+          if(Labels) {
+            if(context) prefix=stripDir(prefix);
+            status=texprocess(texname,dvi ? outname : prename,prefix,
+                              bboxshift,dvi);
+            if(!keep) {
+              for(mem::list<string>::iterator p=files.begin();
+                  p != files.end(); ++p)
+                unlink(p->c_str());
+            }
+          }
+          if(status) {
+            if(context) prename=stripDir(prename);
+            status=postprocess(prename,outname,outputformat,wait,
+                               view,(pdf && Labels) || native,epsformat,svg);
+            if(pdfformat && !keep) {
+              unlink(auxname(prefix,"m9").c_str());
+              unlink(auxname(prefix,"pbsdat").c_str());
+            }
+          }
+        } catch(...) {
+          if(pid != 0) throw;
+          status=false;
+        }
+        if(pid == 0) {
+          cout.flush();
+          _exit(status ? 0 : 1);
         }
       }
     }
@@ -1306,6 +1448,7 @@ bool picture::shipout3(const string& prefix, const string& format,
   if(getSetting<bool>("interrupt"))
     return true;
 
+  timing::count(timing::SHIPOUTS);
   bool webgl=format == "html";
 
 #ifndef HAVE_LIBGLM
@@ -1418,6 +1561,7 @@ bool picture::shipout3(const string& prefix, const string& format,
            background,nlights,lights,diffuse,specular,View,oldpid);
 
   if(webgl) {
+    timing::timer timer(timing::OUTPUT);
     jsfile js;
     string name=buildname(prefix,format);
     js.open(name);
@@ -1448,6 +1592,8 @@ bool picture::shipout3(const string& prefix, const string& format,
 
 bool picture::shipout3(const string& prefix, const string format)
 {
+  timing::timer timer(timing::OUTPUT);
+  timing::count(timing::SHIPOUTS);
   bounds3();
   bool status;
 
@@ -58,6 +58,9 @@ public:
   bool havepng();
   bool havenewpage();
 
+  // Can every element be written directly to a PDF file?
+  bool nativepdf();
+
   bbox bounds();
   bbox3 bounds3();
 
@@ -122,6 +125,15 @@ int opentex(const string& texname, const string& prefix, bool dvi=false);
 
 const char *texpathmessage();
 
+// Wait for the shipouts running in the background (see the jobs setting) to
+// finish, reporting an error for any that failed if report is true.
+void waitShipouts(bool report=true);
+
+// Wait for all of the shipouts running in the background before the TeX code s
+// is run, if it might include their output. Only code with a control sequence
+// can read a file.
+void waitShipoutsReadBy(const string& s);
+
 } //namespace camp
 
 #endif
@@ -31,6 +31,7 @@
 #include "lexical.h"
 #include "camperror.h"
 #include "pen.h"
+#include "timing.h"
 
 iopipestream *instance;
 
@@ -64,6 +65,7 @@ void iopipestream::open(const mem::vector<string> &command, const char *hint,
     for(size_t i=0; i < command.size(); ++i) buf << command[i];
     camp::reportError(buf);
   }
+  timing::count(timing::PROCESSES);
 
   if(pid == 0) {
     if(interact::interactive) signal(SIGINT,SIG_IGN);
@@ -169,6 +171,7 @@ bool iopipestream::tailequals(const char *buf, size_t len, const char *prompt,
 
 string iopipestream::readline()
 {
+  timing::timer timer(timing::EXTERNAL);
   sbuffer.clear();
   int nc;
   do {
@@ -180,6 +183,7 @@ string iopipestream::readline()
 
 void iopipestream::wait(const char *prompt)
 {
+  timing::count(timing::TEXROUNDTRIPS);
   sbuffer.clear();
   size_t plen=strlen(prompt);
 
@@ -194,6 +198,7 @@ void iopipestream::wait(const char *prompt)
 
 int iopipestream::wait()
 {
+  timing::timer timer(timing::EXTERNAL);
   for(;;) {
     int status;
     if (waitpid(pid,&status,0) == -1) {
@@ -22,6 +22,8 @@
 #include "stack.h"
 #include "runtime.h"
 #include "texfile.h"
+#include "picture.h"
+#include "timing.h"
 
 #include "process.h"
 
@@ -161,13 +163,20 @@ enum transMode {
 bool runRunnable(runnable *r, coenv &e, istack &s, transMode tm=TRANS_NORMAL) {
   e.e.beginScope();
 
-  lambda *codelet= tm==TRANS_INTERACTIVE ?
-    interactiveRunnable(r).transAsCodelet(e) :
-    r->transAsCodelet(e);
+  lambda *codelet;
+  {
+    timing::timer timer(timing::TRANSLATE);
+    codelet=tm==TRANS_INTERACTIVE ?
+      interactiveRunnable(r).transAsCodelet(e) :
+      r->transAsCodelet(e);
+  }
   em.sync();
   if(!em.errors()) {
     if(getSetting<bool>("translate")) print(cout,codelet->code);
-    s.run(codelet);
+    {
+      timing::timer timer(timing::EXECUTE);
+      s.run(codelet);
+    }
 
     // Commits the changes made to the environment.
     e.e.collapseScope();
@@ -208,6 +217,7 @@ public:
   virtual void run(coenv &e, istack &s, transMode tm=TRANS_NORMAL) = 0;
 
   virtual void postRun(coenv &, istack &s) {
+    timing::timer timer(timing::EXECUTE);
     run::exitFunction(&s);
   }
 
@@ -237,6 +247,8 @@ public:
 
       postRun(e,s);
 
+      camp::waitShipouts();
+
     } catch(std::bad_alloc&) {
       outOfMemory();
     } catch(quit) {
@@ -245,6 +257,8 @@ public:
       em.statusError();
     }
 
+    camp::waitShipouts(false);
+
     run::cleanup();
 
     em.clear();
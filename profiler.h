@@ -11,15 +11,14 @@
 #include <sys/time.h>
 
 #include <iostream>
+#include <sstream>
+#include <unordered_map>
 
 #include "inst.h"
+#include "program.h"
 
 namespace vm {
 
-#ifdef DEBUG_BLTIN
-string lookupBltin(bltin b);
-#endif
-
 inline position positionFromLambda(lambda *func) {
   if (func == 0)
     return position();
@@ -33,6 +32,41 @@ inline position positionFromLambda(lambda *func) {
   return code.begin()->pos;
 }
 
+// Code identified by its opcode, builtin, and source position rather than by
+// an address, which may be reused once the code is collected. The position is
+// copied with the standard allocator, so that the key is neither collected
+// nor allocated through the collector.
+struct codeSite {
+  Int op;
+  bltin f;
+  std::string file;
+  size_t line,column;
+
+  codeSite(const position& pos, Int op=-1, bltin f=NULL)
+    : op(op), f(f), line(pos.Line()), column(pos.Column()) {
+    if (const fileinfo *info = pos.File())
+      file.assign(info->name().data(),info->name().size());
+  }
+
+  codeSite(const inst& i)
+    : codeSite(i.pos,i.op,i.op == inst::builtin ? get<bltin>(i) : NULL) {}
+
+  bool operator== (const codeSite& s) const {
+    return op == s.op && f == s.f && line == s.line && column == s.column &&
+      file == s.file;
+  }
+};
+
+struct codeSiteHash {
+  size_t operator() (const codeSite& s) const {
+    size_t h = std::hash<std::string>()(s.file);
+    h = 31*h+s.line;
+    h = 31*h+s.column;
+    h = 31*h+(size_t) s.op;
+    return 31*h+std::hash<bltin>()(s.f);
+  }
+};
+
 inline void printNameFromLambda(ostream& out, lambda *func) {
   if (!func) {
     out << "<top level>";
@@ -56,17 +90,74 @@ inline void printNameFromLambda(ostream& out, lambda *func) {
 }
 
 inline void printNameFromBltin(ostream& out, bltin b) {
-#ifdef DEBUG_BLTIN
   string name = lookupBltin(b);
-#else
-  string name = "";
-#endif
 
+  // Fall back on the address of a builtin that was never registered.
   if (!name.empty())
-    out << name << " ";
-  out << "(builtin at " << (void *)b << ")";
+    out << name;
+  else
+    out << "(builtin at " << (void *)b << ")";
 }
 
+// The labels of a code site: the name of its function, builtin, or opcode
+// and where it is.  Code may be collected before a profile is reported, so
+// the labels are formatted when a site is first seen and kept by codeSite
+// with the standard allocator, so that they are neither collected nor
+// profiled themselves.
+struct codeLabel {
+  std::string name;
+  std::string where;
+};
+
+class codeLabels {
+  typedef std::unordered_map<codeSite,codeLabel,codeSiteHash> labelmap;
+  labelmap labels;
+
+public:
+  // Label a function, or the top level if func is null, by where it is
+  // defined.
+  const codeLabel& operator() (lambda *func) {
+    position pos = positionFromLambda(func);
+    codeLabel& l = labels[codeSite(pos)];
+    if (l.where.empty()) {
+      std::ostringstream buf;
+#ifdef DEBUG_FRAME
+      if (func) {
+        buf << func->name;
+        l.name = buf.str();
+        buf.str("");
+      }
+#endif
+      pos.printTerse(buf);
+      l.where = buf.str();
+      if (l.where.empty())
+        l.where = "<top level>";
+    }
+    return l;
+  }
+
+  // Label an instruction by its builtin or opcode and where it is.
+  const codeLabel& operator() (const inst& i) {
+    codeLabel& l = labels[codeSite(i)];
+    if (l.name.empty()) {
+      std::ostringstream buf;
+      if (i.op == inst::builtin)
+        printNameFromBltin(buf, get<bltin>(i));
+      else
+        buf << opname(i.op);
+      l.name = buf.str();
+      buf.str("");
+      i.pos.printTerse(buf);
+      l.where = buf.str();
+    }
+    return l;
+  }
+
+  void clear() {
+    labels.clear();
+  }
+};
+
 class profiler : public gc {
   // To do call graph analysis, each call stack that occurs in practice is
   // represented by a node.  For instance, if f and g are functions, then
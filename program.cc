@@ -6,6 +6,7 @@
  *****/
 
 #include <iostream>
+#include <set>
 #include "util.h"
 #include "callable.h"
 #include "program.h"
@@ -20,22 +21,48 @@ static const char* opnames[] = {
 };
 static const Int numOps = (Int)(sizeof(opnames)/sizeof(char *));
 
+const char *opname(inst::opcode op)
+{
+  Int i = (Int)op;
+  return i < 0 || i >= numOps ? "<<invalid op>>" : opnames[i];
+}
+
 static const char optypes[] = {
 #define OPCODE(name, type) type,
 #include "opcodes.h"
 #undef OPCODE
 };
 
-#ifdef DEBUG_BLTIN
 mem::map<bltin,string> bltinRegistry;
 
 void registerBltin(bltin b, string s) {
   bltinRegistry[b] = s;
 }
 string lookupBltin(bltin b) {
-  return bltinRegistry[b];
+  mem::map<bltin,string>::iterator p=bltinRegistry.find(b);
+  return p == bltinRegistry.end() ? "" : p->second;
+}
+
+
+typedef std::pair<bltin,size_t> inPlaceKey;
+mem::map<inPlaceKey,bltin> inPlaceRegistry;
+std::set<bltin> temporaryRegistry;
+
+void registerInPlace(bltin b, bltin variant, size_t depth) {
+  inPlaceRegistry[inPlaceKey(b,depth)]=variant;
+  temporaryRegistry.insert(b);
+  temporaryRegistry.insert(variant);
+}
+
+bltin lookupInPlace(bltin b, size_t depth) {
+  mem::map<inPlaceKey,bltin>::iterator p=
+    inPlaceRegistry.find(inPlaceKey(b,depth));
+  return p == inPlaceRegistry.end() ? 0 : p->second;
+}
+
+bool returnsTemporary(bltin b) {
+  return temporaryRegistry.find(b) != temporaryRegistry.end();
 }
-#endif
 
 
 ostream& operator<< (ostream& out, const item& i)
@@ -123,10 +150,8 @@ void printInst(ostream& out, const program::label& code,
 
     case 'b':
     {
-#ifdef DEBUG_BLTIN
       string s=lookupBltin(get<bltin>(*code));
       out << " " << (!s.empty() ? s : "<unnamed>") << " ";
-#endif
       break;
     }
 
@@ -63,6 +63,9 @@ void printInst(std::ostream& out, const program::label& code,
 // Prints code until a ret opcode is printed.
 void print(std::ostream& out, program *base);
 
+// Returns the name of an opcode.
+const char *opname(inst::opcode op);
+
 // Inline forwarding functions for vm::program
 inline program::program()
   : code() {}
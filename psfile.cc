@@ -11,9 +11,14 @@
 #include <sstream>
 #include <zlib.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "psfile.h"
 #include "settings.h"
 #include "errormsg.h"
+#include "timing.h"
 #include "array.h"
 #include "stack.h"
 
@@ -94,28 +99,138 @@ void psfile::dealias(unsigned char *a, size_t width, size_t height, size_t n,
     }
   } else {
     size_t nwidth=n*width;
-    for(size_t j=0; j < jstop; ++j) {
-      unsigned char *aj=a+nwidth*j;
-      for(size_t i=0; i < istop; ++i) {
-        unsigned char *ai=aj+n*i;
-        for(size_t k=0; k < n; ++k)
-          ai[k]=average(ai+k,n,nwidth);
+    size_t istopn=istop*n;
+
+    // Each row is averaged in place with the row below it, so split the rows
+    // into bands and save the row following each band before any changes.
+    size_t bands=1;
+#ifdef _OPENMP
+    if(nwidth*jstop >= 65536)
+      bands=min((size_t) omp_get_max_threads(),jstop);
+#endif
+    if(bands == 0) return;
+    size_t rows=(jstop+bands-1)/bands;
+    unsigned char *next=new unsigned char[bands*nwidth];
+    for(size_t b=0; b < bands; ++b) {
+      size_t j=min((b+1)*rows,jstop);
+      memcpy(next+b*nwidth,a+nwidth*j,nwidth);
+    }
+
+#pragma omp parallel for num_threads(bands) if(bands > 1)
+    for(size_t b=0; b < bands; ++b) {
+      size_t jend=min((b+1)*rows,jstop);
+      for(size_t j=b*rows; j < jend; ++j) {
+        unsigned char *aj=a+nwidth*j;
+        unsigned char *bj=j+1 == jend ? next+b*nwidth : aj+nwidth;
+        for(size_t i=0; i < istopn; ++i)
+          aj[i]=((unsigned) aj[i]+(unsigned) aj[i+n]+(unsigned) bj[i]+
+                 (unsigned) bj[i+n])/4;
       }
     }
+    delete[] next;
   }
 }
 
-void psfile::writeCompressed(const unsigned char *a, size_t size)
+namespace {
+
+// Blocks compressed independently by deflateblocks.
+const size_t deflateblocksize=131072;
+const size_t deflatewindow=32768;
+
+// Deflate block i of a, in raw deflate format, into out.
+bool deflateblock(std::vector<unsigned char>& out, const unsigned char *a,
+                  size_t size, size_t i)
 {
-  uLongf compressedSize=compressBound(size);
-  Bytef *compressed=new Bytef[compressedSize];
+  size_t start=i*deflateblocksize;
+  size_t length=min(deflateblocksize,size-start);
+  bool last=start+length == size;
+
+  z_stream z;
+  z.zalloc=Z_NULL;
+  z.zfree=Z_NULL;
+  z.opaque=Z_NULL;
+  if(deflateInit2(&z,Z_DEFAULT_COMPRESSION,Z_DEFLATED,-MAX_WBITS,8,
+                  Z_DEFAULT_STRATEGY) != Z_OK)
+    return false;
+
+  size_t dictionary=min(deflatewindow,start);
+  if(dictionary > 0 &&
+     deflateSetDictionary(&z,a+start-dictionary,dictionary) != Z_OK) {
+    deflateEnd(&z);
+    return false;
+  }
+
+  // Allow for the empty stored block that ends a flushed block.
+  out.resize(deflateBound(&z,length)+16);
+  z.next_in=(Bytef *) a+start;
+  z.avail_in=length;
+  z.next_out=&out[0];
+  z.avail_out=out.size();
+  int status=deflate(&z,last ? Z_FINISH : Z_SYNC_FLUSH);
+  bool ok=last ? status == Z_STREAM_END :
+    status == Z_OK && z.avail_in == 0 && z.avail_out > 0;
+  out.resize(z.total_out);
+  deflateEnd(&z);
+  return ok;
+}
 
-  if(compress(compressed,&compressedSize,a,size) != Z_OK)
-    reportError("image compression failed");
+}
+
+size_t deflateblocks(bytestream& s, const unsigned char *a, size_t size)
+{
+  static const unsigned char header[]={0x78,0x9c};
+  s.put(header,2);
+  size_t total=2;
+
+  size_t blocks=max((size+deflateblocksize-1)/deflateblocksize,(size_t) 1);
+  size_t threads=1;
+#ifdef _OPENMP
+  threads=min((size_t) omp_get_max_threads(),blocks);
+#endif
 
+  // Only one batch of compressed blocks is held in memory at a time. The
+  // worker threads are unknown to the garbage collector, so avoid gc memory.
+  size_t batch=2*threads;
+  std::vector<std::vector<unsigned char> > out(min(batch,blocks));
+  std::vector<uLong> checksum(out.size());
+  uLong adler=adler32(0L,Z_NULL,0);
+
+  for(size_t first=0; first < blocks; first += batch) {
+    size_t n=min(batch,blocks-first);
+    bool ok=true;
+#pragma omp parallel for num_threads(threads) if(threads > 1) \
+  schedule(dynamic) reduction(&&:ok)
+    for(size_t k=0; k < n; ++k) {
+      size_t i=first+k;
+      size_t start=i*deflateblocksize;
+      size_t length=min(deflateblocksize,size-start);
+      checksum[k]=adler32(adler32(0L,Z_NULL,0),a+start,length);
+      ok=deflateblock(out[k],a,size,i) && ok;
+    }
+    if(!ok)
+      reportError("image compression failed");
+
+    for(size_t k=0; k < n; ++k) {
+      size_t i=first+k;
+      size_t length=min(deflateblocksize,size-i*deflateblocksize);
+      adler=adler32_combine(adler,checksum[k],length);
+      if(out[k].size() > 0) s.put(&out[k][0],out[k].size());
+      total += out[k].size();
+    }
+  }
+
+  unsigned char trailer[]={(unsigned char) (adler >> 24),
+                           (unsigned char) (adler >> 16),
+                           (unsigned char) (adler >> 8),
+                           (unsigned char) adler};
+  s.put(trailer,4);
+  return total+4;
+}
+
+void psfile::writeCompressed(const unsigned char *a, size_t size)
+{
   encode85 e(out);
-  for(size_t i=0; i < compressedSize; ++i)
-    e.put(compressed[i]);
+  deflateblocks(e,a,size);
 }
 
 void psfile::close()
@@ -129,6 +244,7 @@ void psfile::close()
       if(!out->good())
         // Don't call reportError since this may be called on handled_error.
         reportFatal("Cannot write to "+filename);
+      timing::wrote(*out);
       delete out;
       out=NULL;
     }
@@ -351,18 +467,11 @@ void psfile::latticeshade(const vm::array& a, const transform& t)
        << "shfill" << newl;
 }
 
-// Axial and radial shading
-void psfile::gradientshade(bool axial, ColorSpace colorspace,
-                           const pen& pena, const pair& a, double ra,
-                           bool extenda, const pen& penb, const pair& b,
-                           double rb, bool extendb)
+void psfile::gradientdict(bool axial, ColorSpace colorspace,
+                          const pen& pena, const pair& a, double ra,
+                          bool extenda, const pen& penb, const pair& b,
+                          double rb, bool extendb)
 {
-  checkLevel();
-  endclip(pena);
-
-  setopacity(pena);
-  checkColorSpace(colorspace);
-
   *out << "<< /ShadingType " << (axial ? "2" : "3") << newl
        << "/ColorSpace /Device" << ColorDeviceSuffix[colorspace] << newl
        << "/Coords [";
@@ -383,8 +492,23 @@ void psfile::gradientshade(bool axial, ColorSpace colorspace,
   *out << "]" << newl
        << "/N 1" << newl
        << ">>" << newl
-       << ">>" << newl
-       << "shfill" << newl;
+       << ">>" << newl;
+}
+
+// Axial and radial shading
+void psfile::gradientshade(bool axial, ColorSpace colorspace,
+                           const pen& pena, const pair& a, double ra,
+                           bool extenda, const pen& penb, const pair& b,
+                           double rb, bool extendb)
+{
+  checkLevel();
+  endclip(pena);
+
+  setopacity(pena);
+  checkColorSpace(colorspace);
+
+  gradientdict(axial,colorspace,pena,a,ra,extenda,penb,b,rb,extendb);
+  *out << "shfill" << newl;
 }
 
 void psfile::gouraudshade(const pen& pentype,
@@ -429,6 +553,33 @@ void psfile::vertexpen(array *pi, int j, ColorSpace colorspace)
   write(*p);
 }
 
+void tensorpoints(pair *z, const path& g, array *zi)
+{
+  if(!(g.cyclic() && g.size() == 4))
+    reportError("specify cyclic path of length 4");
+  for(Int j=4; j > 0; --j) {
+    *(z++)=g.point(j);
+    *(z++)=g.precontrol(j);
+    *(z++)=g.postcontrol(j-1);
+  }
+  if(zi == NULL) { // Coons patch
+    static double nineth=1.0/9.0;
+    for(Int j=0; j < 4; ++j) {
+      *(z++)=nineth*(-4.0*g.point(j)+6.0*(g.precontrol(j)+g.postcontrol(j))
+                     -2.0*(g.point(j-1)+g.point(j+1))
+                     +3.0*(g.precontrol(j-1)+g.postcontrol(j+1))
+                     -g.point(j+2));
+    }
+  } else {
+    if(checkArray(zi) != 4)
+      reportError("specify 4 internal control points for each path");
+    z[0]=read<pair>(zi,0);
+    z[1]=read<pair>(zi,3);
+    z[2]=read<pair>(zi,2);
+    z[3]=read<pair>(zi,1);
+  }
+}
+
 // Tensor-product patch shading
 void psfile::tensorshade(const pen& pentype, const array& pens,
                          const array& boundaries, const array& z)
@@ -457,31 +608,11 @@ void psfile::tensorshade(const pen& pentype, const array& pens,
     // compression (for RGB) afforded by other edge flags really isn't worth
     // the trouble or confusion for the user.
     write(0);
-    path g=read<path>(boundaries,i);
-    if(!(g.cyclic() && g.size() == 4))
-      reportError("specify cyclic path of length 4");
-    for(Int j=4; j > 0; --j) {
-      write(g.point(j));
-      write(g.precontrol(j));
-      write(g.postcontrol(j-1));
-    }
-    if(nz == 0) { // Coons patch
-      static double nineth=1.0/9.0;
-      for(Int j=0; j < 4; ++j) {
-        write(nineth*(-4.0*g.point(j)+6.0*(g.precontrol(j)+g.postcontrol(j))
-                      -2.0*(g.point(j-1)+g.point(j+1))
-                      +3.0*(g.precontrol(j-1)+g.postcontrol(j+1))
-                      -g.point(j+2)));
-      }
-    } else {
-      array *zi=read<array *>(z,i);
-      if(checkArray(zi) != 4)
-        reportError("specify 4 internal control points for each path");
-      write(read<pair>(zi,0));
-      write(read<pair>(zi,3));
-      write(read<pair>(zi,2));
-      write(read<pair>(zi,1));
-    }
+    pair Z[16];
+    tensorpoints(Z,read<path>(boundaries,i),
+                 nz == 0 ? NULL : read<array *>(z,i));
+    for(size_t j=0; j < 16; ++j)
+      write(Z[j]);
 
     array *pi=read<array *>(pens,i);
     if(checkArray(pi) != 4)
@@ -679,8 +810,7 @@ void psfile::outImage(bool antialias, size_t width, size_t height,
     writeCompressed(buffer,count);
   else {
     encode85 e(out);
-    for(size_t i=0; i < count; ++i)
-      e.put(buffer[i]);
+    e.put(buffer,count);
   }
 }
 
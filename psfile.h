@@ -15,6 +15,7 @@
 
 #include "pair.h"
 #include "path.h"
+#include "numformat.h"
 #include "bbox.h"
 #include "pen.h"
 #include "array.h"
@@ -30,70 +31,104 @@ inline void BoundingBox(std::ostream& s, const bbox& box)
   s << "%%HiResBoundingBox: " << std::setprecision(9) << box << newl;
 }
 
+// A destination for encoded binary data.
+class bytestream {
+public:
+  virtual ~bytestream() {}
+  virtual void put(const unsigned char *a, size_t n)=0;
+};
+
 // An ASCII85Encode filter.
-class encode85 {
+class encode85 : public bytestream {
   ostream *out;
-  int tuple;
+  unsigned int tuple;
   int pos;
   int count;
   static const int width=72;
-public:
-  encode85(ostream *out) : out(out), tuple(0), pos(0), count(0) {}
+  static const size_t size=4096;
+  char buf[size];
+  size_t n;
 
-  ~encode85() {
-    if(count > 0)
-      encode(tuple, count);
-    if(pos+2 > width)
-      *out << '\n';
-    *out << "~>\n";
+  void flush() {
+    out->write(buf,n);
+    n=0;
   }
-private:
+
+  void emit(char c) {
+    buf[n++]=c;
+    if(pos++ >= width) {
+      pos=0;
+      buf[n++]='\n';
+    }
+  }
+
   void encode(unsigned int tuple, int count) {
-    unsigned char buf[5], *s=buf;
-    int i=5;
-    do {
-      *s++=tuple % 85;
+    if(n+12 > size) flush();
+    char digits[5];
+    for(int i=4; i >= 0; --i) {
+      digits[i]=(char) (tuple % 85+'!');
       tuple /= 85;
-    } while(--i > 0);
-    i=count;
-    do {
-      *out << (unsigned char) (*--s + '!');
-      if(pos++ >= width) {
-        pos=0;
-        *out << '\n';
-      }
-    } while(i-- > 0);
+    }
+    for(int i=0; i <= count; ++i)
+      emit(digits[i]);
+  }
+
+  void encode(unsigned int tuple) {
+    if(tuple == 0) {
+      if(n+2 > size) flush();
+      emit('z');
+    } else encode(tuple,4);
   }
 
 public:
+  encode85(ostream *out) : out(out), tuple(0), pos(0), count(0), n(0) {}
+
+  ~encode85() {
+    if(count > 0)
+      encode(tuple,count);
+    if(n+4 > size) flush();
+    if(pos+2 > width)
+      buf[n++]='\n';
+    buf[n++]='~';
+    buf[n++]='>';
+    buf[n++]='\n';
+    flush();
+  }
+
   void put(unsigned char c) {
-    switch (count++) {
-      case 0:
-        tuple |= (c << 24);
-        break;
-      case 1:
-        tuple |= (c << 16);
-        break;
-      case 2:
-        tuple |= (c <<  8);
-        break;
-      case 3:
-        tuple |= c;
-        if(tuple == 0) {
-          *out << 'z';
-          if(pos++ >= width) {
-            pos=0;
-            *out << '\n';
-          }
-        } else
-          encode(tuple, count);
-        tuple=0;
-        count=0;
-        break;
+    tuple |= (unsigned int) c << (24-8*count);
+    if(++count == 4) {
+      encode(tuple);
+      tuple=0;
+      count=0;
     }
   }
+
+  // Encode whole tuples directly from the data.
+  void put(const unsigned char *a, size_t m) {
+    for(; count > 0 && m > 0; --m)
+      put(*(a++));
+    const unsigned char *stop=a+(m & ~(size_t) 3);
+    for(; a < stop; a += 4)
+      encode((unsigned int) a[0] << 24 | (unsigned int) a[1] << 16 |
+             (unsigned int) a[2] << 8 | a[3]);
+    for(; a < stop+(m & 3); ++a)
+      put(*a);
+  }
 };
 
+// Compress size bytes of a in the zlib format and pass the result in order
+// to s, returning the compressed size. Large inputs are deflated as
+// independent blocks in parallel, each primed with the preceding 32KB.
+size_t deflateblocks(bytestream& s, const unsigned char *a, size_t size);
+
+void checkColorSpace(ColorSpace colorspace);
+
+// Store in z the 16 control points, in the order of a PostScript or PDF
+// type 7 shading, of the tensor-product patch bounded by the cyclic path g of
+// length 4, with internal control points zi (or a Coons patch if zi is NULL).
+void tensorpoints(pair *z, const path& g, vm::array *zi);
+
 class psfile {
 protected:
   mem::stack<pen> pens;
@@ -119,8 +154,8 @@ public:
     count=0;
   }
 
-  void outImage(bool antialias, size_t width, size_t height,
-                size_t ncomponents);
+  virtual void outImage(bool antialias, size_t width, size_t height,
+                        size_t ncomponents);
 
   void endImage(bool antialias, size_t width, size_t height,
                 size_t ncomponents) {
@@ -147,14 +182,14 @@ public:
     camp::BoundingBox(*out,box);
   }
 
-  void prologue(const bbox& box);
-  void epilogue();
+  virtual void prologue(const bbox& box);
+  virtual void epilogue();
   void header(bool eps);
 
   void close();
 
   void write(double x) {
-    *out << " " << x;
+    realbuffer(*out) << ' ' << x;
   }
 
   void writenewl() {
@@ -162,15 +197,16 @@ public:
   }
 
   void write(pair z) {
-    *out << " " << z.getx() << " " << z.gety();
+    realbuffer(*out) << ' ' << z.getx() << ' ' << z.gety();
   }
 
   void write(transform t) {
-    if(!pdf) *out << "[";
-    *out << " " << t.getxx() << " " << t.getyx()
-         << " " << t.getxy() << " " << t.getyy()
-         << " " << t.getx() << " " << t.gety();
-    if(!pdf) *out << "]";
+    realbuffer s(*out);
+    if(!pdf) s << '[';
+    s << ' ' << t.getxx() << ' ' << t.getyx()
+      << ' ' << t.getxy() << ' ' << t.getyy()
+      << ' ' << t.getx() << ' ' << t.gety();
+    if(!pdf) s << ']';
   }
 
   void resetpen() {
@@ -179,7 +215,7 @@ public:
   }
 
   void setcolor(const pen& p, const string& begin, const string& end);
-  void setopacity(const pen& p);
+  virtual void setopacity(const pen& p);
 
   virtual void setpen(pen p);
 
@@ -200,21 +236,20 @@ public:
   }
 
   virtual void moveto(pair z) {
-    write(z);
-    if(pdf) *out << " m" << newl;
-    else *out << " moveto" << newl;
+    realbuffer(*out) << ' ' << z.getx() << ' ' << z.gety()
+                     << (pdf ? " m\n" : " moveto\n");
   }
 
   virtual void lineto(pair z) {
-    write(z);
-    if(pdf) *out << " l" << newl;
-    else *out << " lineto" << newl;
+    realbuffer(*out) << ' ' << z.getx() << ' ' << z.gety()
+                     << (pdf ? " l\n" : " lineto\n");
   }
 
   virtual void curveto(pair zp, pair zm, pair z1) {
-    write(zp); write(zm); write(z1);
-    if(pdf) *out << " c" << newl;
-    else *out << " curveto" << newl;
+    realbuffer(*out) << ' ' << zp.getx() << ' ' << zp.gety()
+                     << ' ' << zm.getx() << ' ' << zm.gety()
+                     << ' ' << z1.getx() << ' ' << z1.gety()
+                     << (pdf ? " c\n" : " curveto\n");
   }
 
   virtual void closepath() {
@@ -271,6 +306,12 @@ public:
                                   const pen& pena, const pair& a, double ra,
                                   const pen& penb, const pair& b, double rb) {}
 
+  // Write the dictionary of an axial or radial shading.
+  void gradientdict(bool axial, ColorSpace colorspace,
+                    const pen& pena, const pair& a, double ra,
+                    bool extenda, const pen& penb, const pair& b,
+                    double rb, bool extendb);
+
   virtual void gradientshade(bool axial, ColorSpace colorspace,
                              const pen& pena, const pair& a, double ra,
                              bool extenda, const pen& penb, const pair& b,
@@ -287,7 +328,8 @@ public:
 
   void vertexpen(vm::array *pi, int j, ColorSpace colorspace);
 
-  void imageheader(size_t width, size_t height, ColorSpace colorspace);
+  virtual void imageheader(size_t width, size_t height,
+                           ColorSpace colorspace);
 
   void image(const vm::array& a, const vm::array& p, bool antialias);
   void image(const vm::array& a, bool antialias);
@@ -315,10 +357,10 @@ public:
 
   virtual void translate(pair z) {
     if(z == pair(0.0,0.0)) return;
-    if(pdf) *out << " 1 0 0 1 " << newl;
+    if(pdf) *out << " 1 0 0 1";
     write(z);
     if(pdf) *out << " cm" << newl;
-    *out << " translate" << newl;
+    else *out << " translate" << newl;
   }
 
   // Multiply on a transform to the transformation matrix.
@@ -0,0 +1,493 @@
+/*****
+ * region.cc
+ *
+ * Boolean operations on the regions bounded by arrays of paths.
+ *
+ * The paths are flattened into edges, which are split at their mutual
+ * intersections until they meet only at endpoints. A sweep from left to
+ * right then finds, for each edge, the winding numbers of both operands just
+ * below and just above it; an edge lies on the boundary of the result when
+ * these put the two sides on opposite sides of the result. The boundary
+ * edges are finally linked into cycles.
+ *****/
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "region.h"
+
+namespace camp {
+
+namespace {
+
+// The order in which the sweep meets points. A vertical edge is thereby
+// treated as though it were slightly tilted to the right.
+inline bool before(const pair& a, const pair& b)
+{
+  return a.getx() < b.getx() || (a.getx() == b.getx() && a.gety() < b.gety());
+}
+
+// Round z to a multiple of the grid spacing g, a power of two, so that the
+// same crossing computed from different pairs of edges coincides.
+inline pair snap(const pair& z, double g)
+{
+  return pair(round(z.getx()/g)*g,round(z.gety()/g)*g);
+}
+
+struct edge {
+  pair a,b;             // The endpoints, with a before b.
+  Int w[2];             // The change in the winding number of each operand
+                        // from below the edge to above it.
+  bool fresh;           // Not yet tested against the other edges?
+  edge(const pair& a, const pair& b, Int w0, Int w1) :
+    a(a), b(b), fresh(true) {
+    w[0]=w0; w[1]=w1;
+  }
+};
+
+typedef std::vector<edge> edges;
+
+void add(edges& E, const path *g, Int k, double tolerance, double grid)
+{
+  std::vector<pair> z;
+  g->flatten(z,tolerance);
+  size_t m=z.size();
+  if(m < 2) return;
+  for(size_t i=0; i < m; ++i)
+    z[i]=snap(z[i],grid);
+  for(size_t i=0; i < m; ++i) {
+    const pair& u=z[i];
+    const pair& v=z[i+1 < m ? i+1 : 0];
+    if(u == v) continue;
+    Int w=before(u,v) ? 1 : -1;
+    if(w > 0) E.push_back(edge(u,v,k == 0 ? w : 0,k == 1 ? w : 0));
+    else E.push_back(edge(v,u,k == 0 ? w : 0,k == 1 ? w : 0));
+  }
+}
+
+// A point z at which to cut edge i, ordered along the edge by t.
+struct cut {
+  size_t i;
+  double t;
+  pair z;
+  cut(size_t i, const edge& e, const pair& z) :
+    i(i), t(dot(z-e.a,e.b-e.a)), z(z) {}
+};
+
+inline bool operator < (const cut& c, const cut& d)
+{
+  return c.i < d.i || (c.i == d.i && c.t < d.t);
+}
+
+// Does the edge e pass through the square of side g centered at the grid
+// point v, other than at an endpoint? The squares are half open, so that an
+// edge through a corner shared by several of them passes only through the one
+// above and to the right of the corner; otherwise rerouting an edge through
+// the squares it touches could touch others indefinitely.
+bool passes(const edge& e, const pair& v, double g)
+{
+  if(v == e.a || v == e.b) return false;
+  // In units of the grid the endpoints are integers, so the edge can meet the
+  // square without entering it only at a corner.
+  pair a=(e.a-v)/g;
+  pair d=(e.b-e.a)/g;
+  double t0=0.0, t1=1.0;
+  double p[]={-d.getx(),d.getx(),-d.gety(),d.gety()};
+  double q[]={a.getx()+0.5,0.5-a.getx(),a.gety()+0.5,0.5-a.gety()};
+  for(int k=0; k < 4; ++k) {
+    if(p[k] == 0) {
+      if(q[k] < 0) return false;
+    } else {
+      double r=q[k]/p[k];
+      if(p[k] < 0) {
+        if(r > t0) t0=r;
+      } else if(r < t1) t1=r;
+      if(t0 > t1) return false;
+    }
+  }
+  if(t0 < t1) return true;
+  pair c=a+t0*d;
+  return c.getx() < 0 && c.gety() < 0;
+}
+
+// If the edges s and t cross, append their crossing, snapped to the grid,
+// to Z.
+void crossing(std::vector<pair>& Z, const edge& s, const edge& t, double grid)
+{
+  double o1=orient2d(s.a,s.b,t.a);
+  double o2=orient2d(s.a,s.b,t.b);
+  if(o1*o2 >= 0) return;
+  double o3=orient2d(t.a,t.b,s.a);
+  double o4=orient2d(t.a,t.b,s.b);
+  if(o3*o4 >= 0) return;
+  Z.push_back(snap(s.a+(s.b-s.a)*(o3/(o3-o4)),grid));
+}
+
+// Snap round the edges: make the grid squares containing their crossings and
+// their endpoints hot, and route each edge through the centers of the hot
+// squares that it passes through. Only pairs involving an edge created by a
+// previous pass are tested for crossings, but every endpoint, including those
+// of such edges, is hot on each pass. Return whether any edge was split.
+bool split(edges& E, double grid)
+{
+  size_t n=E.size();
+  if(n == 0) return false;
+
+  // Bucket the edges, enlarged by the grid spacing, into a square array of
+  // cells, each holding about a few edges.
+  double xmin=E[0].a.getx(), xmax=xmin;
+  double ymin=E[0].a.gety(), ymax=ymin;
+  for(size_t i=0; i < n; ++i) {
+    xmin=std::min(xmin,E[i].a.getx());
+    xmax=std::max(xmax,E[i].b.getx());
+    ymin=std::min(ymin,std::min(E[i].a.gety(),E[i].b.gety()));
+    ymax=std::max(ymax,std::max(E[i].a.gety(),E[i].b.gety()));
+  }
+  xmin -= grid; ymin -= grid;
+  size_t N=std::max((size_t) sqrt((double) n/4.0),(size_t) 1);
+  double sx=N/(xmax+grid-xmin);
+  double sy=N/(ymax+grid-ymin);
+  std::vector<bbox> B(n);
+  for(size_t i=0; i < n; ++i) {
+    const edge& e=E[i];
+    B[i]=bbox(e.a.getx()-grid,std::min(e.a.gety(),e.b.gety())-grid,
+              e.b.getx()+grid,std::max(e.a.gety(),e.b.gety())+grid);
+  }
+  auto cellx=[=](double x) {return std::min((size_t) ((x-xmin)*sx),N-1);};
+  auto celly=[=](double y) {return std::min((size_t) ((y-ymin)*sy),N-1);};
+
+
+  std::vector<size_t> start(N*N+1,0);
+  for(size_t i=0; i < n; ++i)
+    for(size_t x=cellx(B[i].left); x <= cellx(B[i].right); ++x)
+      for(size_t y=celly(B[i].bottom); y <= celly(B[i].top); ++y)
+        ++start[x*N+y+1];
+  for(size_t k=0; k < N*N; ++k)
+    start[k+1] += start[k];
+  std::vector<size_t> entries(start[N*N]);
+  std::vector<size_t> pos(start.begin(),start.end()-1);
+  for(size_t i=0; i < n; ++i)
+    for(size_t x=cellx(B[i].left); x <= cellx(B[i].right); ++x)
+      for(size_t y=celly(B[i].bottom); y <= celly(B[i].top); ++y)
+        entries[pos[x*N+y]++]=i;
+
+  // Test each pair of overlapping edges in the cell containing the lower
+  // left corner of their overlap.
+  std::vector<pair> Z;
+  for(size_t k=0; k < N*N; ++k) {
+    size_t x=k/N, y=k % N;
+    for(size_t l=start[k]; l < start[k+1]; ++l) {
+      size_t i=entries[l];
+      for(size_t m=l+1; m < start[k+1]; ++m) {
+        size_t j=entries[m];
+        if(!E[i].fresh && !E[j].fresh) continue;
+        double left=std::max(B[i].left,B[j].left);
+        double bottom=std::max(B[i].bottom,B[j].bottom);
+        if(left > std::min(B[i].right,B[j].right) ||
+           bottom > std::min(B[i].top,B[j].top) ||
+           cellx(left) != x || celly(bottom) != y) continue;
+        crossing(Z,E[i],E[j],grid);
+      }
+    }
+  }
+  for(size_t i=0; i < n; ++i)
+    E[i].fresh=false;
+
+  for(size_t i=0; i < n; ++i) {
+    Z.push_back(E[i].a);
+    Z.push_back(E[i].b);
+  }
+  std::sort(Z.begin(),Z.end(),before);
+  Z.erase(std::unique(Z.begin(),Z.end()),Z.end());
+
+  // Bucket the hot squares by their centers and find those met by each edge.
+  size_t nZ=Z.size();
+  std::vector<size_t> hotstart(N*N+1,0);
+  for(size_t h=0; h < nZ; ++h)
+    ++hotstart[cellx(Z[h].getx())*N+celly(Z[h].gety())+1];
+  for(size_t k=0; k < N*N; ++k)
+    hotstart[k+1] += hotstart[k];
+  std::vector<pair> hot(nZ);
+  std::vector<size_t> hotpos(hotstart.begin(),hotstart.end()-1);
+  for(size_t h=0; h < nZ; ++h)
+    hot[hotpos[cellx(Z[h].getx())*N+celly(Z[h].gety())]++]=Z[h];
+
+  std::vector<cut> C;
+  for(size_t i=0; i < n; ++i)
+    for(size_t x=cellx(B[i].left); x <= cellx(B[i].right); ++x)
+      for(size_t y=celly(B[i].bottom); y <= celly(B[i].top); ++y) {
+        size_t k=x*N+y;
+        for(size_t h=hotstart[k]; h < hotstart[k+1]; ++h)
+          if(passes(E[i],hot[h],grid))
+            C.push_back(cut(i,E[i],hot[h]));
+      }
+  if(C.empty()) return false;
+
+  // Replace each cut edge by its pieces, reversing those that run backwards.
+  std::sort(C.begin(),C.end());
+  size_t c=0;
+  size_t nC=C.size();
+  for(size_t i=0; i < n; ++i) {
+    if(c == nC || C[c].i != i) continue;
+    edge e=E[i];
+    pair a=e.a;
+    bool first=true;
+    for(; c <= nC; ++c) {
+      bool last=c == nC || C[c].i != i;
+      const pair& z=last ? e.b : C[c].z;
+      if(z != a) {
+        edge f=before(a,z) ? edge(a,z,e.w[0],e.w[1]) :
+          edge(z,a,-e.w[0],-e.w[1]);
+        if(first) E[i]=f;
+        else E.push_back(f);
+        first=false;
+        a=z;
+      }
+      if(last) break;
+    }
+  }
+  return true;
+}
+
+inline bool samegeometry(const edge& e, const edge& f)
+{
+  return e.a == f.a && e.b == f.b;
+}
+
+// Combine coincident edges, dropping those that cancel.
+void merge(edges& E)
+{
+  std::sort(E.begin(),E.end(),[](const edge& e, const edge& f) {
+      return before(e.a,f.a) || (e.a == f.a && before(e.b,f.b));});
+  size_t m=0;
+  for(size_t i=0; i < E.size();) {
+    edge e=E[i];
+    for(++i; i < E.size() && samegeometry(E[i],e); ++i) {
+      e.w[0] += E[i].w[0];
+      e.w[1] += E[i].w[1];
+    }
+    if(e.w[0] != 0 || e.w[1] != 0) E[m++]=e;
+  }
+  E.resize(m,edge(pair(),pair(),0,0));
+}
+
+// Order the edges crossed by the sweep from bottom to top. The edges meet
+// only at endpoints and i is compared with j only when both are crossed.
+struct below {
+  const edges& E;
+  below(const edges& E) : E(E) {}
+
+  bool operator()(size_t i, size_t j) const {
+    if(i == j) return false;
+    const edge& s=E[i];
+    const edge& t=E[j];
+    double o;
+    if(s.a == t.a) {
+      o=orient2d(s.a,s.b,t.b);
+      if(o != 0) return o > 0;
+    } else if(before(t.a,s.a)) {
+      o=orient2d(t.a,t.b,s.a);
+      if(o == 0) o=orient2d(t.a,t.b,s.b);
+      if(o != 0) return o < 0;
+    } else {
+      o=orient2d(s.a,s.b,t.a);
+      if(o == 0) o=orient2d(s.a,s.b,t.b);
+      if(o != 0) return o > 0;
+    }
+    return i < j;
+  }
+};
+
+struct event {
+  pair z;
+  size_t i;
+  bool start;
+  event(const pair& z, size_t i, bool start) : z(z), i(i), start(start) {}
+};
+
+// Edges ending at a point leave the sweep before those starting there enter.
+inline bool operator < (const event& e, const event& f)
+{
+  return before(e.z,f.z) || (e.z == f.z && !e.start && f.start);
+}
+
+inline bool apply(regionop op, bool p, bool q)
+{
+  switch(op) {
+    case UNION: return p || q;
+    case INTERSECTION: return p && q;
+    case DIFFERENCE: return p && !q;
+    case XOR: return p != q;
+  }
+  return false;
+}
+
+struct link {
+  pair from,to;
+  link(const pair& from, const pair& to) : from(from), to(to) {}
+};
+
+// Remove vertices at which a cycle continues straight ahead.
+void straighten(std::vector<pair>& z)
+{
+  std::vector<pair> w;
+  for(size_t i=0; i < z.size(); ++i) {
+    const pair& v=z[i];
+    while(w.size() >= 2) {
+      const pair& u=w[w.size()-2];
+      const pair& c=w.back();
+      if(orient2d(u,c,v) != 0 || dot(c-u,v-c) <= 0) break;
+      w.pop_back();
+    }
+    w.push_back(v);
+  }
+  size_t start=0;
+  while(w.size()-start >= 3) {
+    size_t m=w.size();
+    if(orient2d(w[m-2],w[m-1],w[start]) == 0 &&
+       dot(w[m-1]-w[m-2],w[start]-w[m-1]) > 0)
+      w.pop_back();
+    else if(orient2d(w[m-1],w[start],w[start+1]) == 0 &&
+            dot(w[start]-w[m-1],w[start+1]-w[start]) > 0)
+      ++start;
+    else break;
+  }
+  z.assign(w.begin()+start,w.end());
+}
+
+}
+
+void combine(mem::vector<path>& P, const std::vector<const path *>& p,
+             const std::vector<const path *>& q, regionop op,
+             const pen& fillrule, double tolerance)
+{
+  if(tolerance <= 0) {
+    bbox b;
+    for(size_t i=0; i < p.size(); ++i)
+      if(p[i]->size() > 0) b += p[i]->bounds();
+    for(size_t i=0; i < q.size(); ++i)
+      if(q[i]->size() > 0) b += q[i]->bounds();
+    if(b.empty) return;
+    tolerance=1e-4*std::max(b.right-b.left,b.top-b.bottom);
+    if(tolerance == 0) return;
+  }
+
+  // Vertices are snapped to a grid much finer than the tolerance.
+  double grid=exp2(floor(log2(tolerance))-4);
+
+  edges E;
+  for(size_t i=0; i < p.size(); ++i)
+    add(E,p[i],0,tolerance,grid);
+  for(size_t i=0; i < q.size(); ++i)
+    add(E,q[i],1,tolerance,grid);
+
+  // Rounding rarely leaves new crossings; a few passes settle them. The sweep
+  // requires that no crossings remain.
+  const Int maxpasses=64;
+  for(Int pass=0; split(E,grid); ++pass)
+    if(pass == maxpasses)
+      reportError("region edges could not be snap rounded");
+  merge(E);
+
+  size_t n=E.size();
+  std::vector<event> events;
+  events.reserve(2*n);
+  for(size_t i=0; i < n; ++i) {
+    events.push_back(event(E[i].a,i,true));
+    events.push_back(event(E[i].b,i,false));
+  }
+  std::sort(events.begin(),events.end());
+
+  typedef std::set<size_t,below> sweep;
+  sweep S((below(E)));
+  std::vector<sweep::iterator> where(n);
+  std::vector<Int> above(2*n);
+  std::vector<link> L;
+
+  size_t nevents=events.size();
+  for(size_t e=0; e < nevents;) {
+    pair z=events[e].z;
+    for(; e < nevents && events[e].z == z && !events[e].start; ++e)
+      S.erase(where[events[e].i]);
+    size_t first=e;
+    for(; e < nevents && events[e].z == z; ++e) {
+      size_t i=events[e].i;
+      where[i]=S.insert(i).first;
+    }
+    if(first == e) continue;
+
+    // The edges starting at z are adjacent in the sweep.
+    sweep::iterator k=where[events[first].i];
+    while(k != S.begin()) {
+      sweep::iterator prev=k;
+      --prev;
+      if(E[*prev].a != z) break;
+      k=prev;
+    }
+    Int w0=0, w1=0;
+    if(k != S.begin()) {
+      sweep::iterator prev=k;
+      --prev;
+      w0=above[2*(*prev)];
+      w1=above[2*(*prev)+1];
+    }
+    for(; k != S.end() && E[*k].a == z; ++k) {
+      const edge& s=E[*k];
+      bool in=apply(op,fillrule.inside(w0),fillrule.inside(w1));
+      w0 += s.w[0];
+      w1 += s.w[1];
+      above[2*(*k)]=w0;
+      above[2*(*k)+1]=w1;
+      bool out=apply(op,fillrule.inside(w0),fillrule.inside(w1));
+      if(in != out) {
+        if(out) L.push_back(link(s.a,s.b));
+        else L.push_back(link(s.b,s.a));
+      }
+    }
+  }
+
+  // Link the boundary edges, each with the result to its left, into cycles.
+  std::sort(L.begin(),L.end(),[](const link& l, const link& m) {
+      return before(l.from,m.from);});
+  size_t nL=L.size();
+  std::vector<bool> used(nL,false);
+  std::vector<size_t> next(nL); // The first possibly unused link from here.
+  for(size_t i=0; i < nL; ++i)
+    next[i]=i;
+
+  std::vector<pair> z;
+  for(size_t i=0; i < nL; ++i) {
+    if(used[i]) continue;
+    z.clear();
+    pair start=L[i].from;
+    size_t k=i;
+    bool closed=false;
+    for(;;) {
+      used[k]=true;
+      z.push_back(L[k].from);
+      const pair& to=L[k].to;
+      if(to == start) {
+        closed=true;
+        break;
+      }
+      size_t j=std::lower_bound(L.begin(),L.end(),link(to,to),
+                                [](const link& l, const link& m) {
+                                  return before(l.from,m.from);})-L.begin();
+      if(j == nL) break;
+      size_t first=j;
+      j=next[first];
+      while(j < nL && L[j].from == to && used[j]) ++j;
+      next[first]=j;
+      if(j == nL || L[j].from != to) break;
+      k=j;
+    }
+    // A chain that cannot be linked back to its start bounds nothing.
+    if(!closed) continue;
+    straighten(z);
+    if(z.size() >= 3)
+      P.push_back(straightpath(z,true));
+  }
+}
+
+}
@@ -0,0 +1,27 @@
+/*****
+ * region.h
+ *
+ * Boolean operations on the regions bounded by arrays of paths.
+ *****/
+
+#ifndef REGION_H
+#define REGION_H
+
+#include "path.h"
+#include "pen.h"
+
+namespace camp {
+
+enum regionop {UNION,INTERSECTION,DIFFERENCE,XOR};
+
+// Append to P cyclic piecewise straight paths, each with the region to its
+// left, bounding the result of combining with op the regions bounded by the
+// paths p and q under the given fill rule. Curved segments are first
+// flattened to within tolerance.
+void combine(mem::vector<path>& P, const std::vector<const path *>& p,
+             const std::vector<const path *>& q, regionop op,
+             const pen& fillrule, double tolerance);
+
+}
+
+#endif
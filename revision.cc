@@ -0,0 +1,2 @@
+const char *REVISION="";
+const char *AsyGLVersion="1.00";
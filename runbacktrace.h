@@ -0,0 +1,8 @@
+/***** Autogenerated from runbacktrace.in; changes will be overwritten *****/
+
+#ifndef runbacktrace_H
+#define runbacktrace_H
+namespace run {
+}
+
+#endif // runbacktrace_H
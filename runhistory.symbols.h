@@ -0,0 +1,22 @@
+/*****
+ * This file is automatically generated by findsym.pl
+ * Changes will be overwritten.
+ *****/
+
+// If the ADDSYMBOL macro is not already defined, define it with the default
+// purpose of referring to an external pre-translated symbol, such that
+// SYM(name) also refers to that symbol.
+#ifndef ADDSYMBOL
+    #define ADDSYMBOL(name) extern sym::symbol PRETRANSLATED_SYMBOL_##name
+    #define SYM(name) PRETRANSLATED_SYMBOL_##name
+#endif
+
+ADDSYMBOL(history);
+ADDSYMBOL(n);
+ADDSYMBOL(name);
+ADDSYMBOL(prompt);
+ADDSYMBOL(readline);
+ADDSYMBOL(saveline);
+ADDSYMBOL(store);
+ADDSYMBOL(tabcompletion);
+ADDSYMBOL(value);
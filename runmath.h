@@ -0,0 +1,12 @@
+/***** Autogenerated from runmath.in; changes will be overwritten *****/
+
+#ifndef runmath_H
+#define runmath_H
+namespace run {
+void boolMemEq(vm::stack *);
+void boolMemNeq(vm::stack *);
+void boolFuncEq(vm::stack *);
+void boolFuncNeq(vm::stack *);
+}
+
+#endif // runmath_H
@@ -0,0 +1,1168 @@
+/***** Autogenerated from runpath.in; changes will be overwritten *****/
+
+#line 1 "runtimebase.in"
+/*****
+ * runtimebase.in
+ * Andy Hammerlindl  2009/07/28
+ *
+ * Common declarations needed for all code-generating .in files.
+ *
+ *****/
+
+
+#line 1 "runpath.in"
+/*****
+ * runpath.in
+ *
+ * Runtime functions for path operations.
+ *
+ *****/
+
+#line 1 "runtimebase.in"
+#include "stack.h"
+#include "types.h"
+#include "builtin.h"
+#include "entry.h"
+#include "errormsg.h"
+#include "array.h"
+#include "triple.h"
+#include "callable.h"
+#include "opsymbols.h"
+
+using vm::stack;
+using vm::error;
+using vm::array;
+using vm::read;
+using vm::callable;
+using types::formal;
+using types::function;
+using camp::triple;
+
+#define PRIMITIVE(name,Name,asyName) using types::prim##Name;
+#include <primitives.h>
+#undef PRIMITIVE
+
+typedef double real;
+
+void unused(void *);
+
+namespace run {
+array *copyArray(array *a);
+array *copyArray2(array *a);
+array *copyArray3(array *a);
+
+double *copyTripleArray2Components(array *a, size_t &N,
+                                   GCPlacement placement=NoGC);
+triple *copyTripleArray2C(array *a, size_t &N,
+                          GCPlacement placement=NoGC);
+}
+
+function *realRealFunction();
+
+#define CURRENTPEN processData().currentpen
+
+#line 20 "runpath.in"
+#include "path.h"
+#include "arrayop.h"
+#include "predicates.h"
+#include "stroke.h"
+#include "region.h"
+
+using namespace camp;
+using namespace vm;
+
+typedef array boolarray;
+typedef array Intarray;
+typedef array pairarray;
+typedef array realarray;
+typedef array realarray2;
+typedef array patharray;
+
+using types::booleanArray;
+using types::IntArray;
+using types::pairArray;
+using types::realArray;
+using types::realArray2;
+using types::pathArray;
+
+Int windingnumber(array *p, camp::pair z)
+{
+  size_t size=checkArray(p);
+  Int count=0;
+  for(size_t i=0; i < size; i++)
+    count += read<path *>(p,i)->windingnumber(z);
+  return count;
+}
+
+#ifdef _OPENMP
+// Minimum number of points worth distributing over threads.
+static const size_t parallelpoints=1 << 12;
+#endif
+
+// Compute the winding numbers of the points z relative to the paths g
+// with a single index of their segments.
+Int *windingnumbers(const std::vector<const path *>& g, array *z)
+{
+  windingIndex index(g);
+  size_t n=checkArray(z);
+  pair *Z=new pair[n];
+  for(size_t i=0; i < n; ++i)
+    Z[i]=read<pair>(z,i);
+  Int *count=new Int[n];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,256) if(n >= parallelpoints)
+#endif
+  for(size_t i=0; i < n; ++i)
+    count[i]=index.windingnumber(Z[i]);
+  delete[] Z;
+  return count;
+}
+
+std::vector<const path *> pathPointers(array *p)
+{
+  size_t size=checkArray(p);
+  std::vector<const path *> g(size);
+  for(size_t i=0; i < size; i++)
+    g[i]=read<path *>(p,i);
+  return g;
+}
+
+array *insideArray(const std::vector<const path *>& g, array *z,
+                   const pen& fillrule)
+{
+  size_t n=checkArray(z);
+  Int *count=windingnumbers(g,z);
+  array *b=new array(n);
+  for(size_t i=0; i < n; ++i)
+    (*b)[i]=fillrule.inside(count[i]);
+  delete[] count;
+  return b;
+}
+
+array *toArray(const mem::vector<path>& P)
+{
+  size_t n=P.size();
+  array *a=new array(n);
+  for(size_t i=0; i < n; ++i)
+    (*a)[i]=P[i];
+  return a;
+}
+
+array *combine(array *p, array *q, regionop op, const pen& fillrule,
+               double tolerance)
+{
+  mem::vector<path> P;
+  combine(P,pathPointers(p),pathPointers(q),op,fillrule,tolerance);
+  return toArray(P);
+}
+
+// Autogenerated routines:
+
+
+
+#ifndef NOSYM
+#include "runpath.symbols.h"
+
+#endif
+namespace run {
+#line 117 "runpath.in"
+void nullPath(stack *Stack)
+{
+#line 118 "runpath.in"
+  {Stack->push<path>(nullpath); return;}
+}
+
+#line 122 "runpath.in"
+// bool ==(path a, path b);
+void gen_runpath1(stack *Stack)
+{
+  path b=vm::pop<path>(Stack);
+  path a=vm::pop<path>(Stack);
+#line 123 "runpath.in"
+  {Stack->push<bool>(a == b); return;}
+}
+
+#line 127 "runpath.in"
+// bool !=(path a, path b);
+void gen_runpath2(stack *Stack)
+{
+  path b=vm::pop<path>(Stack);
+  path a=vm::pop<path>(Stack);
+#line 128 "runpath.in"
+  {Stack->push<bool>(!(a == b)); return;}
+}
+
+#line 132 "runpath.in"
+// pair point(path p, Int t);
+void gen_runpath3(stack *Stack)
+{
+  Int t=vm::pop<Int>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 133 "runpath.in"
+  {Stack->push<pair>(p.point((Int) t)); return;}
+}
+
+#line 137 "runpath.in"
+// pair point(path p, real t);
+void gen_runpath4(stack *Stack)
+{
+  real t=vm::pop<real>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 138 "runpath.in"
+  {Stack->push<pair>(p.point(t)); return;}
+}
+
+#line 142 "runpath.in"
+// pair precontrol(path p, Int t);
+void gen_runpath5(stack *Stack)
+{
+  Int t=vm::pop<Int>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 143 "runpath.in"
+  {Stack->push<pair>(p.precontrol((Int) t)); return;}
+}
+
+#line 147 "runpath.in"
+// pair precontrol(path p, real t);
+void gen_runpath6(stack *Stack)
+{
+  real t=vm::pop<real>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 148 "runpath.in"
+  {Stack->push<pair>(p.precontrol(t)); return;}
+}
+
+#line 152 "runpath.in"
+// pair postcontrol(path p, Int t);
+void gen_runpath7(stack *Stack)
+{
+  Int t=vm::pop<Int>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 153 "runpath.in"
+  {Stack->push<pair>(p.postcontrol((Int) t)); return;}
+}
+
+#line 157 "runpath.in"
+// pair postcontrol(path p, real t);
+void gen_runpath8(stack *Stack)
+{
+  real t=vm::pop<real>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 158 "runpath.in"
+  {Stack->push<pair>(p.postcontrol(t)); return;}
+}
+
+#line 162 "runpath.in"
+// pair dir(path p, Int t, Int sign=0, bool normalize=true);
+void gen_runpath9(stack *Stack)
+{
+  bool normalize=vm::pop<bool>(Stack,true);
+  Int sign=vm::pop<Int>(Stack,0);
+  Int t=vm::pop<Int>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 163 "runpath.in"
+  {Stack->push<pair>(p.dir(t,sign,normalize)); return;}
+}
+
+#line 167 "runpath.in"
+// pair dir(path p, real t, bool normalize=true);
+void gen_runpath10(stack *Stack)
+{
+  bool normalize=vm::pop<bool>(Stack,true);
+  real t=vm::pop<real>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 168 "runpath.in"
+  {Stack->push<pair>(p.dir(t,normalize)); return;}
+}
+
+#line 172 "runpath.in"
+// pair accel(path p, Int t, Int sign=0);
+void gen_runpath11(stack *Stack)
+{
+  Int sign=vm::pop<Int>(Stack,0);
+  Int t=vm::pop<Int>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 173 "runpath.in"
+  {Stack->push<pair>(p.accel(t,sign)); return;}
+}
+
+#line 177 "runpath.in"
+// pair accel(path p, real t);
+void gen_runpath12(stack *Stack)
+{
+  real t=vm::pop<real>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 178 "runpath.in"
+  {Stack->push<pair>(p.accel(t)); return;}
+}
+
+#line 182 "runpath.in"
+// pairarray* point(path p, realarray *t);
+void gen_runpath13(stack *Stack)
+{
+  realarray * t=vm::pop<realarray *>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 183 "runpath.in"
+  size_t n=checkArray(t);
+  double *T;
+  copyArrayC(T,t);
+  pair *z=new pair[n];
+  p.point(z,T,n);
+  array *a=copyCArray(n,z);
+  delete[] z;
+  delete[] T;
+  {Stack->push<pairarray*>(a); return;}
+}
+
+#line 195 "runpath.in"
+// pairarray* dir(path p, realarray *t, bool normalize=true);
+void gen_runpath14(stack *Stack)
+{
+  bool normalize=vm::pop<bool>(Stack,true);
+  realarray * t=vm::pop<realarray *>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 196 "runpath.in"
+  size_t n=checkArray(t);
+  double *T;
+  copyArrayC(T,t);
+  pair *z=new pair[n];
+  p.dir(z,T,n,normalize);
+  array *a=copyCArray(n,z);
+  delete[] z;
+  delete[] T;
+  {Stack->push<pairarray*>(a); return;}
+}
+
+#line 208 "runpath.in"
+// pairarray* accel(path p, realarray *t);
+void gen_runpath15(stack *Stack)
+{
+  realarray * t=vm::pop<realarray *>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 209 "runpath.in"
+  size_t n=checkArray(t);
+  double *T;
+  copyArrayC(T,t);
+  pair *z=new pair[n];
+  p.accel(z,T,n);
+  array *a=copyCArray(n,z);
+  delete[] z;
+  delete[] T;
+  {Stack->push<pairarray*>(a); return;}
+}
+
+#line 221 "runpath.in"
+// real radius(path p, real t);
+void gen_runpath16(stack *Stack)
+{
+  real t=vm::pop<real>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 222 "runpath.in"
+  pair v=p.dir(t,false);
+  pair a=p.accel(t);
+  real d=dot(a,v);
+  real v2=v.abs2();
+  real a2=a.abs2();
+  real denom=v2*a2-d*d;
+  real r=v2*sqrt(v2);
+  {Stack->push<real>(denom > 0 ? r/sqrt(denom) : 0.0); return;}
+}
+
+#line 233 "runpath.in"
+// path reverse(path p);
+void gen_runpath17(stack *Stack)
+{
+  path p=vm::pop<path>(Stack);
+#line 234 "runpath.in"
+  {Stack->push<path>(p.reverse()); return;}
+}
+
+#line 238 "runpath.in"
+// path subpath(path p, Int a, Int b);
+void gen_runpath18(stack *Stack)
+{
+  Int b=vm::pop<Int>(Stack);
+  Int a=vm::pop<Int>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 239 "runpath.in"
+  {Stack->push<path>(p.subpath((Int) a, (Int) b)); return;}
+}
+
+#line 243 "runpath.in"
+// path subpath(path p, real a, real b);
+void gen_runpath19(stack *Stack)
+{
+  real b=vm::pop<real>(Stack);
+  real a=vm::pop<real>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 244 "runpath.in"
+  {Stack->push<path>(p.subpath(a,b)); return;}
+}
+
+#line 248 "runpath.in"
+// path nurb(pair z0, pair z1, pair z2, pair z3,          real w0, real w1, real w2, real w3, Int m);
+void gen_runpath20(stack *Stack)
+{
+  Int m=vm::pop<Int>(Stack);
+  real w3=vm::pop<real>(Stack);
+  real w2=vm::pop<real>(Stack);
+  real w1=vm::pop<real>(Stack);
+  real w0=vm::pop<real>(Stack);
+  pair z3=vm::pop<pair>(Stack);
+  pair z2=vm::pop<pair>(Stack);
+  pair z1=vm::pop<pair>(Stack);
+  pair z0=vm::pop<pair>(Stack);
+#line 250 "runpath.in"
+  {Stack->push<path>(nurb(z0,z1,z2,z3,w0,w1,w2,w3,m)); return;}
+}
+
+#line 254 "runpath.in"
+// Int length(path p);
+void gen_runpath21(stack *Stack)
+{
+  path p=vm::pop<path>(Stack);
+#line 255 "runpath.in"
+  {Stack->push<Int>(p.length()); return;}
+}
+
+#line 259 "runpath.in"
+// bool cyclic(path p);
+void gen_runpath22(stack *Stack)
+{
+  path p=vm::pop<path>(Stack);
+#line 260 "runpath.in"
+  {Stack->push<bool>(p.cyclic()); return;}
+}
+
+#line 264 "runpath.in"
+// bool straight(path p, Int t);
+void gen_runpath23(stack *Stack)
+{
+  Int t=vm::pop<Int>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 265 "runpath.in"
+  {Stack->push<bool>(p.straight(t)); return;}
+}
+
+#line 269 "runpath.in"
+// path unstraighten(path p);
+void gen_runpath24(stack *Stack)
+{
+  path p=vm::pop<path>(Stack);
+#line 270 "runpath.in"
+  {Stack->push<path>(p.unstraighten()); return;}
+}
+
+#line 274 "runpath.in"
+// bool piecewisestraight(path p);
+void gen_runpath25(stack *Stack)
+{
+  path p=vm::pop<path>(Stack);
+#line 275 "runpath.in"
+  {Stack->push<bool>(p.piecewisestraight()); return;}
+}
+
+#line 279 "runpath.in"
+// real arclength(path p);
+void gen_runpath26(stack *Stack)
+{
+  path p=vm::pop<path>(Stack);
+#line 280 "runpath.in"
+  {Stack->push<real>(p.arclength()); return;}
+}
+
+#line 284 "runpath.in"
+// real arclength(pair z0, pair c0, pair c1, pair z1);
+void gen_runpath27(stack *Stack)
+{
+  pair z1=vm::pop<pair>(Stack);
+  pair c1=vm::pop<pair>(Stack);
+  pair c0=vm::pop<pair>(Stack);
+  pair z0=vm::pop<pair>(Stack);
+#line 285 "runpath.in"
+  {Stack->push<real>(arcLength(z0,c0,c1,z1)); return;}
+}
+
+#line 289 "runpath.in"
+// real arctime(path p, real L);
+void gen_runpath28(stack *Stack)
+{
+  real L=vm::pop<real>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 290 "runpath.in"
+  {Stack->push<real>(p.arctime(L)); return;}
+}
+
+#line 294 "runpath.in"
+// realarray* arctime(path p, realarray *L);
+void gen_runpath29(stack *Stack)
+{
+  realarray * L=vm::pop<realarray *>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 295 "runpath.in"
+  size_t n=checkArray(L);
+  double *l;
+  copyArrayC(l,L);
+  double *t=new double[n];
+  p.arctime(t,l,n);
+  array *a=copyCArray(n,t);
+  delete[] t;
+  delete[] l;
+  {Stack->push<realarray*>(a); return;}
+}
+
+#line 307 "runpath.in"
+// real dirtime(path p, pair z);
+void gen_runpath30(stack *Stack)
+{
+  pair z=vm::pop<pair>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 308 "runpath.in"
+  {Stack->push<real>(p.directiontime(z)); return;}
+}
+
+#line 312 "runpath.in"
+// path flatten(path p, real tolerance);
+void gen_runpath31(stack *Stack)
+{
+  real tolerance=vm::pop<real>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 313 "runpath.in"
+  {Stack->push<path>(p.flatten(tolerance)); return;}
+}
+
+#line 317 "runpath.in"
+// patharray* flatten(explicit patharray *p, real tolerance);
+void gen_runpath32(stack *Stack)
+{
+  real tolerance=vm::pop<real>(Stack);
+  patharray * p=vm::pop<patharray *>(Stack);
+#line 318 "runpath.in"
+  size_t n=checkArray(p);
+  array *a=new array(n);
+  for(size_t i=0; i < n; ++i)
+    (*a)[i]=read<path>(p,i).flatten(tolerance);
+  {Stack->push<patharray*>(a); return;}
+}
+
+#line 326 "runpath.in"
+// patharray* _strokepath(path g, pen p, real tolerance);
+void gen_runpath33(stack *Stack)
+{
+  real tolerance=vm::pop<real>(Stack);
+  pen p=vm::pop<pen>(Stack);
+  path g=vm::pop<path>(Stack);
+#line 327 "runpath.in"
+  mem::vector<path> P;
+  strokepath(P,g,p,tolerance);
+  {Stack->push<patharray*>(toArray(P)); return;}
+}
+
+#line 333 "runpath.in"
+// patharray* union(patharray *p, pen fillrule=CURRENTPEN,                 real tolerance=0);
+void gen_runpath34(stack *Stack)
+{
+  real tolerance=vm::pop<real>(Stack,0);
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  patharray * p=vm::pop<patharray *>(Stack);
+#line 335 "runpath.in"
+  {Stack->push<patharray*>(combine(p,new array(0),UNION,fillrule,tolerance)); return;}
+}
+
+#line 339 "runpath.in"
+// patharray* union(patharray *p, patharray *q,                 pen fillrule=CURRENTPEN, real tolerance=0);
+void gen_runpath35(stack *Stack)
+{
+  real tolerance=vm::pop<real>(Stack,0);
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  patharray * q=vm::pop<patharray *>(Stack);
+  patharray * p=vm::pop<patharray *>(Stack);
+#line 341 "runpath.in"
+  {Stack->push<patharray*>(combine(p,q,UNION,fillrule,tolerance)); return;}
+}
+
+#line 345 "runpath.in"
+// patharray* intersection(patharray *p, patharray *q,                        pen fillrule=CURRENTPEN, real tolerance=0);
+void gen_runpath36(stack *Stack)
+{
+  real tolerance=vm::pop<real>(Stack,0);
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  patharray * q=vm::pop<patharray *>(Stack);
+  patharray * p=vm::pop<patharray *>(Stack);
+#line 347 "runpath.in"
+  {Stack->push<patharray*>(combine(p,q,INTERSECTION,fillrule,tolerance)); return;}
+}
+
+#line 351 "runpath.in"
+// patharray* difference(patharray *p, patharray *q,                      pen fillrule=CURRENTPEN, real tolerance=0);
+void gen_runpath37(stack *Stack)
+{
+  real tolerance=vm::pop<real>(Stack,0);
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  patharray * q=vm::pop<patharray *>(Stack);
+  patharray * p=vm::pop<patharray *>(Stack);
+#line 353 "runpath.in"
+  {Stack->push<patharray*>(combine(p,q,DIFFERENCE,fillrule,tolerance)); return;}
+}
+
+#line 357 "runpath.in"
+// patharray* xor(patharray *p, patharray *q,               pen fillrule=CURRENTPEN, real tolerance=0);
+void gen_runpath38(stack *Stack)
+{
+  real tolerance=vm::pop<real>(Stack,0);
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  patharray * q=vm::pop<patharray *>(Stack);
+  patharray * p=vm::pop<patharray *>(Stack);
+#line 359 "runpath.in"
+  {Stack->push<patharray*>(combine(p,q,XOR,fillrule,tolerance)); return;}
+}
+
+#line 363 "runpath.in"
+// realarray* intersect(path p, path q, real fuzz=-1);
+void gen_runpath39(stack *Stack)
+{
+  real fuzz=vm::pop<real>(Stack,-1);
+  path q=vm::pop<path>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 364 "runpath.in"
+  bool exact=fuzz <= 0.0;
+  if(fuzz < 0)
+    fuzz=BigFuzz*::max(::max(length(p.max()),length(p.min())),
+                       ::max(length(q.max()),length(q.min())));
+  std::vector<real> S,T;
+  real s,t;
+  if(intersections(s,t,S,T,p,q,fuzz,true,exact)) {
+    array *V=new array(2);
+    (*V)[0]=s;
+    (*V)[1]=t;
+    {Stack->push<realarray*>(V); return;}
+  }
+  {Stack->push<realarray*>(new array(0)); return;}
+}
+
+#line 380 "runpath.in"
+// realarray2* intersections(path p, path q, real fuzz=-1);
+void gen_runpath40(stack *Stack)
+{
+  real fuzz=vm::pop<real>(Stack,-1);
+  path q=vm::pop<path>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 381 "runpath.in"
+  bool exact=fuzz <= 0.0;
+  if(fuzz < 0.0)
+    fuzz=BigFuzz*::max(::max(length(p.max()),length(p.min())),
+                       ::max(length(q.max()),length(q.min())));
+  real s,t;
+  std::vector<real> S,T;
+  intersections(s,t,S,T,p,q,fuzz,false,true);
+  size_t n=S.size();
+  if(n == 0 && !exact) {
+    if(intersections(s,t,S,T,p,q,fuzz,true,false)) {
+      array *V=new array(1);
+      array *Vi=new array(2);
+      (*V)[0]=Vi;
+      (*Vi)[0]=s;
+      (*Vi)[1]=t;
+      {Stack->push<realarray2*>(V); return;}
+    }
+  }
+  array *V=new array(n);
+  for(size_t i=0; i < n; ++i) {
+    array *Vi=new array(2);
+    (*V)[i]=Vi;
+    (*Vi)[0]=S[i];
+    (*Vi)[1]=T[i];
+  }
+  stable_sort(V->begin(),V->end(),run::compare2<real>());
+  {Stack->push<realarray2*>(V); return;}
+}
+
+#line 411 "runpath.in"
+// realarray* intersections(path p, explicit pair a, explicit pair b, real fuzz=-1);
+void gen_runpath41(stack *Stack)
+{
+  real fuzz=vm::pop<real>(Stack,-1);
+  pair b=vm::pop<pair>(Stack);
+  pair a=vm::pop<pair>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 412 "runpath.in"
+  if(fuzz < 0)
+    fuzz=BigFuzz*::max(::max(length(p.max()),length(p.min())),
+                       ::max(length(a),length(b)));
+  std::vector<real> S;
+  intersections(S,p,a,b,fuzz);
+  sort(S.begin(),S.end());
+  size_t n=S.size();
+  array *V=new array(n);
+  for(size_t i=0; i < n; ++i)
+    (*V)[i]=S[i];
+  {Stack->push<realarray*>(V); return;}
+}
+
+// Return the intersection point of the extensions of the line segments
+// PQ and pq.
+#line 428 "runpath.in"
+// pair extension(pair P, pair Q, pair p, pair q);
+void gen_runpath42(stack *Stack)
+{
+  pair q=vm::pop<pair>(Stack);
+  pair p=vm::pop<pair>(Stack);
+  pair Q=vm::pop<pair>(Stack);
+  pair P=vm::pop<pair>(Stack);
+#line 429 "runpath.in"
+  pair ac=P-Q;
+  pair bd=q-p;
+  real det=ac.getx()*bd.gety()-ac.gety()*bd.getx();
+  if(det == 0) {Stack->push<pair>(pair(infinity,infinity)); return;}
+  {Stack->push<pair>(P+((p.getx()-P.getx())*bd.gety()-(p.gety()-P.gety())*bd.getx())*ac/det); return;}
+}
+
+#line 437 "runpath.in"
+// Int size(path p);
+void gen_runpath43(stack *Stack)
+{
+  path p=vm::pop<path>(Stack);
+#line 438 "runpath.in"
+  {Stack->push<Int>(p.size()); return;}
+}
+
+#line 442 "runpath.in"
+// path &(path p, path q);
+void gen_runpath44(stack *Stack)
+{
+  path q=vm::pop<path>(Stack);
+  path p=vm::pop<path>(Stack);
+#line 443 "runpath.in"
+  {Stack->push<path>(camp::concat(p,q)); return;}
+}
+
+#line 447 "runpath.in"
+// pair min(explicit path p);
+void gen_runpath45(stack *Stack)
+{
+  path p=vm::pop<path>(Stack);
+#line 448 "runpath.in"
+  {Stack->push<pair>(p.min()); return;}
+}
+
+#line 452 "runpath.in"
+// pair max(explicit path p);
+void gen_runpath46(stack *Stack)
+{
+  path p=vm::pop<path>(Stack);
+#line 453 "runpath.in"
+  {Stack->push<pair>(p.max()); return;}
+}
+
+#line 457 "runpath.in"
+// Int size(patharray *p);
+void gen_runpath47(stack *Stack)
+{
+  patharray * p=vm::pop<patharray *>(Stack);
+#line 458 "runpath.in"
+  size_t size=checkArray(p);
+  Int count=0;
+  for (size_t i = 0; i < size; i++)
+    count += read<path *>(p,i)->size();
+  {Stack->push<Int>(count); return;}
+}
+
+#line 466 "runpath.in"
+// pair min(patharray *p);
+void gen_runpath48(stack *Stack)
+{
+  patharray * p=vm::pop<patharray *>(Stack);
+#line 467 "runpath.in"
+  size_t size=checkArray(p);
+
+  if(size == 0)
+    error(nopoints);
+
+  path *g = p->read<path *>(0);
+  pair z = g->min();
+  double minx = z.getx(), miny = z.gety();
+
+  for (size_t i = 1; i < size; ++i) {
+    path *g = p->read<path *>(i);
+    pair z = g->min();
+    double x = z.getx(), y = z.gety();
+    if (x < minx)
+      minx = x;
+    if (y < miny)
+      miny = y;
+  }
+
+  {Stack->push<pair>(pair(minx, miny)); return;}
+}
+
+#line 490 "runpath.in"
+// pair max(patharray *p);
+void gen_runpath49(stack *Stack)
+{
+  patharray * p=vm::pop<patharray *>(Stack);
+#line 491 "runpath.in"
+  size_t size=checkArray(p);
+
+  if(size == 0)
+    error(nopoints);
+
+  path *g = p->read<path *>(0);
+  pair z = g->max();
+  double maxx = z.getx(), maxy = z.gety();
+
+  for (size_t i = 1; i < size; ++i) {
+    path *g = p->read<path *>(i);
+    pair z = g->max();
+    double x = z.getx(), y = z.gety();
+    if (x > maxx)
+      maxx = x;
+    if (y > maxy)
+      maxy = y;
+  }
+
+  {Stack->push<pair>(pair(maxx, maxy)); return;}
+}
+
+#line 514 "runpath.in"
+// pair minAfterTransform(transform t, patharray *p);
+void gen_runpath50(stack *Stack)
+{
+  patharray * p=vm::pop<patharray *>(Stack);
+  transform t=vm::pop<transform>(Stack);
+#line 515 "runpath.in"
+  size_t size=checkArray(p);
+
+  if(size == 0)
+    error(nopoints);
+
+  path g = p->read<path *>(0)->transformed(t);
+  pair z = g.min();
+  double minx = z.getx(), miny = z.gety();
+
+  for (size_t i = 1; i < size; ++i) {
+    path g = p->read<path *>(i)->transformed(t);
+    pair z = g.min();
+    double x = z.getx(), y = z.gety();
+    if (x < minx)
+      minx = x;
+    if (y < miny)
+      miny = y;
+  }
+
+  {Stack->push<pair>(pair(minx, miny)); return;}
+}
+
+#line 538 "runpath.in"
+// pair maxAfterTransform(transform t, patharray *p);
+void gen_runpath51(stack *Stack)
+{
+  patharray * p=vm::pop<patharray *>(Stack);
+  transform t=vm::pop<transform>(Stack);
+#line 539 "runpath.in"
+  size_t size=checkArray(p);
+
+  if(size == 0)
+    error(nopoints);
+
+  path g = p->read<path *>(0)->transformed(t);
+  pair z = g.max();
+  double maxx = z.getx(), maxy = z.gety();
+
+  for (size_t i = 1; i < size; ++i) {
+    path g = p->read<path *>(i)->transformed(t);
+    pair z = g.max();
+    double x = z.getx(), y = z.gety();
+    if (x > maxx)
+      maxx = x;
+    if (y > maxy)
+      maxy = y;
+  }
+
+  {Stack->push<pair>(pair(maxx, maxy)); return;}
+}
+
+#line 562 "runpath.in"
+// realarray* mintimes(path p);
+void gen_runpath52(stack *Stack)
+{
+  path p=vm::pop<path>(Stack);
+#line 563 "runpath.in"
+  array *V=new array(2);
+  pair z=p.mintimes();
+  (*V)[0]=z.getx();
+  (*V)[1]=z.gety();
+  {Stack->push<realarray*>(V); return;}
+}
+
+#line 571 "runpath.in"
+// realarray* maxtimes(path p);
+void gen_runpath53(stack *Stack)
+{
+  path p=vm::pop<path>(Stack);
+#line 572 "runpath.in"
+  array *V=new array(2);
+  pair z=p.maxtimes();
+  (*V)[0]=z.getx();
+  (*V)[1]=z.gety();
+  {Stack->push<realarray*>(V); return;}
+}
+
+#line 580 "runpath.in"
+// real relativedistance(real theta, real phi, real t, bool atleast);
+void gen_runpath54(stack *Stack)
+{
+  bool atleast=vm::pop<bool>(Stack);
+  real t=vm::pop<real>(Stack);
+  real phi=vm::pop<real>(Stack);
+  real theta=vm::pop<real>(Stack);
+#line 581 "runpath.in"
+  {Stack->push<real>(camp::velocity(theta,phi,tension(t,atleast))); return;}
+}
+
+#line 585 "runpath.in"
+// Int windingnumber(patharray *p, pair z);
+void gen_runpath55(stack *Stack)
+{
+  pair z=vm::pop<pair>(Stack);
+  patharray * p=vm::pop<patharray *>(Stack);
+#line 586 "runpath.in"
+  {Stack->push<Int>(windingnumber(p,z)); return;}
+}
+
+#line 590 "runpath.in"
+// bool inside(explicit patharray *g, pair z, pen fillrule=CURRENTPEN);
+void gen_runpath56(stack *Stack)
+{
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  pair z=vm::pop<pair>(Stack);
+  patharray * g=vm::pop<patharray *>(Stack);
+#line 591 "runpath.in"
+  {Stack->push<bool>(fillrule.inside(windingnumber(g,z))); return;}
+}
+
+#line 595 "runpath.in"
+// bool inside(path g, pair z, pen fillrule=CURRENTPEN);
+void gen_runpath57(stack *Stack)
+{
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  pair z=vm::pop<pair>(Stack);
+  path g=vm::pop<path>(Stack);
+#line 596 "runpath.in"
+  {Stack->push<bool>(fillrule.inside(g.windingnumber(z))); return;}
+}
+
+// Vectorized versions of the above, for many points.
+#line 602 "runpath.in"
+// Intarray* windingnumber(patharray *p, pairarray *z);
+void gen_runpath58(stack *Stack)
+{
+  pairarray * z=vm::pop<pairarray *>(Stack);
+  patharray * p=vm::pop<patharray *>(Stack);
+#line 603 "runpath.in"
+  size_t n=checkArray(z);
+  Int *count=windingnumbers(pathPointers(p),z);
+  array *w=new array(n);
+  for(size_t i=0; i < n; ++i)
+    (*w)[i]=count[i];
+  delete[] count;
+  {Stack->push<Intarray*>(w); return;}
+}
+
+#line 613 "runpath.in"
+// boolarray* inside(explicit patharray *g, pairarray *z,                  pen fillrule=CURRENTPEN);
+void gen_runpath59(stack *Stack)
+{
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  pairarray * z=vm::pop<pairarray *>(Stack);
+  patharray * g=vm::pop<patharray *>(Stack);
+#line 615 "runpath.in"
+  {Stack->push<boolarray*>(insideArray(pathPointers(g),z,fillrule)); return;}
+}
+
+#line 619 "runpath.in"
+// boolarray* inside(path g, pairarray *z, pen fillrule=CURRENTPEN);
+void gen_runpath60(stack *Stack)
+{
+  pen fillrule=vm::pop<pen>(Stack,CURRENTPEN);
+  pairarray * z=vm::pop<pairarray *>(Stack);
+  path g=vm::pop<path>(Stack);
+#line 620 "runpath.in"
+  {Stack->push<boolarray*>(insideArray(std::vector<const path *>(1,&g),z,fillrule)); return;}
+}
+
+// Return a positive (negative) value if a--b--c--cycle is oriented
+// counterclockwise (clockwise) or zero if all three points are colinear.
+// Equivalently, return a positive (negative) value if c lies to the
+// left (right) of the line through a and b or zero if c lies on this line.
+// The value returned is the determinant
+// |a.x a.y 1|
+// |b.x b.y 1|
+// |c.x c.y 1|
+//
+#line 633 "runpath.in"
+// real orient(pair a, pair b, pair c);
+void gen_runpath61(stack *Stack)
+{
+  pair c=vm::pop<pair>(Stack);
+  pair b=vm::pop<pair>(Stack);
+  pair a=vm::pop<pair>(Stack);
+#line 634 "runpath.in"
+  {Stack->push<real>(orient2d(a,b,c)); return;}
+}
+
+// Return a positive (negative) value if d lies inside (outside)
+// the circle passing through the counterclockwise-oriented points a,b,c
+// or zero if d lies on this circle.
+// The value returned is the determinant
+// |a.x a.y a.x^2+a.y^2 1|
+// |b.x b.y b.x^2+b.y^2 1|
+// |c.x c.y c.x^2+c.y^2 1|
+// |d.x d.y d.x^2+d.y^2 1|
+#line 646 "runpath.in"
+// real incircle(pair a, pair b, pair c, pair d);
+void gen_runpath62(stack *Stack)
+{
+  pair d=vm::pop<pair>(Stack);
+  pair c=vm::pop<pair>(Stack);
+  pair b=vm::pop<pair>(Stack);
+  pair a=vm::pop<pair>(Stack);
+#line 647 "runpath.in"
+  {Stack->push<real>(incircle(a.getx(),a.gety(),b.getx(),b.gety(),c.getx(),c.gety(),
+                  d.getx(),d.gety())); return;}
+}
+
+} // namespace run
+
+namespace trans {
+
+void gen_runpath_venv(venv &ve)
+{
+#line 117 "runpath.in"
+  REGISTER_BLTIN(run::nullPath,"nullPath");
+#line 122 "runpath.in"
+  addFunc(ve, run::gen_runpath1, primBoolean(), SYM_EQ, formal(primPath(), SYM(a), false, false), formal(primPath(), SYM(b), false, false));
+#line 127 "runpath.in"
+  addFunc(ve, run::gen_runpath2, primBoolean(), SYM_NEQ, formal(primPath(), SYM(a), false, false), formal(primPath(), SYM(b), false, false));
+#line 132 "runpath.in"
+  addFunc(ve, run::gen_runpath3, primPair(), SYM(point), formal(primPath(), SYM(p), false, false), formal(primInt(), SYM(t), false, false));
+#line 137 "runpath.in"
+  addFunc(ve, run::gen_runpath4, primPair(), SYM(point), formal(primPath(), SYM(p), false, false), formal(primReal(), SYM(t), false, false));
+#line 142 "runpath.in"
+  addFunc(ve, run::gen_runpath5, primPair(), SYM(precontrol), formal(primPath(), SYM(p), false, false), formal(primInt(), SYM(t), false, false));
+#line 147 "runpath.in"
+  addFunc(ve, run::gen_runpath6, primPair(), SYM(precontrol), formal(primPath(), SYM(p), false, false), formal(primReal(), SYM(t), false, false));
+#line 152 "runpath.in"
+  addFunc(ve, run::gen_runpath7, primPair(), SYM(postcontrol), formal(primPath(), SYM(p), false, false), formal(primInt(), SYM(t), false, false));
+#line 157 "runpath.in"
+  addFunc(ve, run::gen_runpath8, primPair(), SYM(postcontrol), formal(primPath(), SYM(p), false, false), formal(primReal(), SYM(t), false, false));
+#line 162 "runpath.in"
+  addFunc(ve, run::gen_runpath9, primPair(), SYM(dir), formal(primPath(), SYM(p), false, false), formal(primInt(), SYM(t), false, false), formal(primInt(), SYM(sign), true, false), formal(primBoolean(), SYM(normalize), true, false));
+#line 167 "runpath.in"
+  addFunc(ve, run::gen_runpath10, primPair(), SYM(dir), formal(primPath(), SYM(p), false, false), formal(primReal(), SYM(t), false, false), formal(primBoolean(), SYM(normalize), true, false));
+#line 172 "runpath.in"
+  addFunc(ve, run::gen_runpath11, primPair(), SYM(accel), formal(primPath(), SYM(p), false, false), formal(primInt(), SYM(t), false, false), formal(primInt(), SYM(sign), true, false));
+#line 177 "runpath.in"
+  addFunc(ve, run::gen_runpath12, primPair(), SYM(accel), formal(primPath(), SYM(p), false, false), formal(primReal(), SYM(t), false, false));
+#line 182 "runpath.in"
+  addFunc(ve, run::gen_runpath13, pairArray(), SYM(point), formal(primPath(), SYM(p), false, false), formal(realArray(), SYM(t), false, false));
+#line 195 "runpath.in"
+  addFunc(ve, run::gen_runpath14, pairArray(), SYM(dir), formal(primPath(), SYM(p), false, false), formal(realArray(), SYM(t), false, false), formal(primBoolean(), SYM(normalize), true, false));
+#line 208 "runpath.in"
+  addFunc(ve, run::gen_runpath15, pairArray(), SYM(accel), formal(primPath(), SYM(p), false, false), formal(realArray(), SYM(t), false, false));
+#line 221 "runpath.in"
+  addFunc(ve, run::gen_runpath16, primReal(), SYM(radius), formal(primPath(), SYM(p), false, false), formal(primReal(), SYM(t), false, false));
+#line 233 "runpath.in"
+  addFunc(ve, run::gen_runpath17, primPath(), SYM(reverse), formal(primPath(), SYM(p), false, false));
+#line 238 "runpath.in"
+  addFunc(ve, run::gen_runpath18, primPath(), SYM(subpath), formal(primPath(), SYM(p), false, false), formal(primInt(), SYM(a), false, false), formal(primInt(), SYM(b), false, false));
+#line 243 "runpath.in"
+  addFunc(ve, run::gen_runpath19, primPath(), SYM(subpath), formal(primPath(), SYM(p), false, false), formal(primReal(), SYM(a), false, false), formal(primReal(), SYM(b), false, false));
+#line 248 "runpath.in"
+  addFunc(ve, run::gen_runpath20, primPath(), SYM(nurb), formal(primPair(), SYM(z0), false, false), formal(primPair(), SYM(z1), false, false), formal(primPair(), SYM(z2), false, false), formal(primPair(), SYM(z3), false, false), formal(primReal(), SYM(w0), false, false), formal(primReal(), SYM(w1), false, false), formal(primReal(), SYM(w2), false, false), formal(primReal(), SYM(w3), false, false), formal(primInt(), SYM(m), false, false));
+#line 254 "runpath.in"
+  addFunc(ve, run::gen_runpath21, primInt(), SYM(length), formal(primPath(), SYM(p), false, false));
+#line 259 "runpath.in"
+  addFunc(ve, run::gen_runpath22, primBoolean(), SYM(cyclic), formal(primPath(), SYM(p), false, false));
+#line 264 "runpath.in"
+  addFunc(ve, run::gen_runpath23, primBoolean(), SYM(straight), formal(primPath(), SYM(p), false, false), formal(primInt(), SYM(t), false, false));
+#line 269 "runpath.in"
+  addFunc(ve, run::gen_runpath24, primPath(), SYM(unstraighten), formal(primPath(), SYM(p), false, false));
+#line 274 "runpath.in"
+  addFunc(ve, run::gen_runpath25, primBoolean(), SYM(piecewisestraight), formal(primPath(), SYM(p), false, false));
+#line 279 "runpath.in"
+  addFunc(ve, run::gen_runpath26, primReal(), SYM(arclength), formal(primPath(), SYM(p), false, false));
+#line 284 "runpath.in"
+  addFunc(ve, run::gen_runpath27, primReal(), SYM(arclength), formal(primPair(), SYM(z0), false, false), formal(primPair(), SYM(c0), false, false), formal(primPair(), SYM(c1), false, false), formal(primPair(), SYM(z1), false, false));
+#line 289 "runpath.in"
+  addFunc(ve, run::gen_runpath28, primReal(), SYM(arctime), formal(primPath(), SYM(p), false, false), formal(primReal(), SYM(l), false, false));
+#line 294 "runpath.in"
+  addFunc(ve, run::gen_runpath29, realArray(), SYM(arctime), formal(primPath(), SYM(p), false, false), formal(realArray(), SYM(l), false, false));
+#line 307 "runpath.in"
+  addFunc(ve, run::gen_runpath30, primReal(), SYM(dirtime), formal(primPath(), SYM(p), false, false), formal(primPair(), SYM(z), false, false));
+#line 312 "runpath.in"
+  addFunc(ve, run::gen_runpath31, primPath(), SYM(flatten), formal(primPath(), SYM(p), false, false), formal(primReal(), SYM(tolerance), false, false));
+#line 317 "runpath.in"
+  addFunc(ve, run::gen_runpath32, pathArray(), SYM(flatten), formal(pathArray(), SYM(p), false, true), formal(primReal(), SYM(tolerance), false, false));
+#line 326 "runpath.in"
+  addFunc(ve, run::gen_runpath33, pathArray(), SYM(_strokepath), formal(primPath(), SYM(g), false, false), formal(primPen(), SYM(p), false, false), formal(primReal(), SYM(tolerance), false, false));
+#line 333 "runpath.in"
+  addFunc(ve, run::gen_runpath34, pathArray(), SYM(union), formal(pathArray(), SYM(p), false, false), formal(primPen(), SYM(fillrule), true, false), formal(primReal(), SYM(tolerance), true, false));
+#line 339 "runpath.in"
+  addFunc(ve, run::gen_runpath35, pathArray(), SYM(union), formal(pathArray(), SYM(p), false, false), formal(pathArray(), SYM(q), false, false), formal(primPen(), SYM(fillrule), true, false), formal(primReal(), SYM(tolerance), true, false));
+#line 345 "runpath.in"
+  addFunc(ve, run::gen_runpath36, pathArray(), SYM(intersection), formal(pathArray(), SYM(p), false, false), formal(pathArray(), SYM(q), false, false), formal(primPen(), SYM(fillrule), true, false), formal(primReal(), SYM(tolerance), true, false));
+#line 351 "runpath.in"
+  addFunc(ve, run::gen_runpath37, pathArray(), SYM(difference), formal(pathArray(), SYM(p), false, false), formal(pathArray(), SYM(q), false, false), formal(primPen(), SYM(fillrule), true, false), formal(primReal(), SYM(tolerance), true, false));
+#line 357 "runpath.in"
+  addFunc(ve, run::gen_runpath38, pathArray(), SYM(xor), formal(pathArray(), SYM(p), false, false), formal(pathArray(), SYM(q), false, false), formal(primPen(), SYM(fillrule), true, false), formal(primReal(), SYM(tolerance), true, false));
+#line 363 "runpath.in"
+  addFunc(ve, run::gen_runpath39, realArray(), SYM(intersect), formal(primPath(), SYM(p), false, false), formal(primPath(), SYM(q), false, false), formal(primReal(), SYM(fuzz), true, false));
+#line 380 "runpath.in"
+  addFunc(ve, run::gen_runpath40, realArray2(), SYM(intersections), formal(primPath(), SYM(p), false, false), formal(primPath(), SYM(q), false, false), formal(primReal(), SYM(fuzz), true, false));
+#line 411 "runpath.in"
+  addFunc(ve, run::gen_runpath41, realArray(), SYM(intersections), formal(primPath(), SYM(p), false, false), formal(primPair(), SYM(a), false, true), formal(primPair(), SYM(b), false, true), formal(primReal(), SYM(fuzz), true, false));
+#line 426 "runpath.in"
+  addFunc(ve, run::gen_runpath42, primPair(), SYM(extension), formal(primPair(), SYM(p), false, false), formal(primPair(), SYM(q), false, false), formal(primPair(), SYM(p), false, false), formal(primPair(), SYM(q), false, false));
+#line 437 "runpath.in"
+  addFunc(ve, run::gen_runpath43, primInt(), SYM(size), formal(primPath(), SYM(p), false, false));
+#line 442 "runpath.in"
+  addFunc(ve, run::gen_runpath44, primPath(), SYM_AMPERSAND, formal(primPath(), SYM(p), false, false), formal(primPath(), SYM(q), false, false));
+#line 447 "runpath.in"
+  addFunc(ve, run::gen_runpath45, primPair(), SYM(min), formal(primPath(), SYM(p), false, true));
+#line 452 "runpath.in"
+  addFunc(ve, run::gen_runpath46, primPair(), SYM(max), formal(primPath(), SYM(p), false, true));
+#line 457 "runpath.in"
+  addFunc(ve, run::gen_runpath47, primInt(), SYM(size), formal(pathArray(), SYM(p), false, false));
+#line 466 "runpath.in"
+  addFunc(ve, run::gen_runpath48, primPair(), SYM(min), formal(pathArray(), SYM(p), false, false));
+#line 490 "runpath.in"
+  addFunc(ve, run::gen_runpath49, primPair(), SYM(max), formal(pathArray(), SYM(p), false, false));
+#line 514 "runpath.in"
+  addFunc(ve, run::gen_runpath50, primPair(), SYM(minAfterTransform), formal(primTransform(), SYM(t), false, false), formal(pathArray(), SYM(p), false, false));
+#line 538 "runpath.in"
+  addFunc(ve, run::gen_runpath51, primPair(), SYM(maxAfterTransform), formal(primTransform(), SYM(t), false, false), formal(pathArray(), SYM(p), false, false));
+#line 562 "runpath.in"
+  addFunc(ve, run::gen_runpath52, realArray(), SYM(mintimes), formal(primPath(), SYM(p), false, false));
+#line 571 "runpath.in"
+  addFunc(ve, run::gen_runpath53, realArray(), SYM(maxtimes), formal(primPath(), SYM(p), false, false));
+#line 580 "runpath.in"
+  addFunc(ve, run::gen_runpath54, primReal(), SYM(relativedistance), formal(primReal(), SYM(theta), false, false), formal(primReal(), SYM(phi), false, false), formal(primReal(), SYM(t), false, false), formal(primBoolean(), SYM(atleast), false, false));
+#line 585 "runpath.in"
+  addFunc(ve, run::gen_runpath55, primInt(), SYM(windingnumber), formal(pathArray(), SYM(p), false, false), formal(primPair(), SYM(z), false, false));
+#line 590 "runpath.in"
+  addFunc(ve, run::gen_runpath56, primBoolean(), SYM(inside), formal(pathArray(), SYM(g), false, true), formal(primPair(), SYM(z), false, false), formal(primPen(), SYM(fillrule), true, false));
+#line 595 "runpath.in"
+  addFunc(ve, run::gen_runpath57, primBoolean(), SYM(inside), formal(primPath(), SYM(g), false, false), formal(primPair(), SYM(z), false, false), formal(primPen(), SYM(fillrule), true, false));
+#line 601 "runpath.in"
+  addFunc(ve, run::gen_runpath58, IntArray(), SYM(windingnumber), formal(pathArray(), SYM(p), false, false), formal(pairArray(), SYM(z), false, false));
+#line 613 "runpath.in"
+  addFunc(ve, run::gen_runpath59, booleanArray(), SYM(inside), formal(pathArray(), SYM(g), false, true), formal(pairArray(), SYM(z), false, false), formal(primPen(), SYM(fillrule), true, false));
+#line 619 "runpath.in"
+  addFunc(ve, run::gen_runpath60, booleanArray(), SYM(inside), formal(primPath(), SYM(g), false, false), formal(pairArray(), SYM(z), false, false), formal(primPen(), SYM(fillrule), true, false));
+#line 624 "runpath.in"
+  addFunc(ve, run::gen_runpath61, primReal(), SYM(orient), formal(primPair(), SYM(a), false, false), formal(primPair(), SYM(b), false, false), formal(primPair(), SYM(c), false, false));
+#line 638 "runpath.in"
+  addFunc(ve, run::gen_runpath62, primReal(), SYM(incircle), formal(primPair(), SYM(a), false, false), formal(primPair(), SYM(b), false, false), formal(primPair(), SYM(c), false, false), formal(primPair(), SYM(d), false, false));
+}
+
+} // namespace trans
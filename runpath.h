@@ -0,0 +1,9 @@
+/***** Autogenerated from runpath.in; changes will be overwritten *****/
+
+#ifndef runpath_H
+#define runpath_H
+namespace run {
+void nullPath(vm::stack *);
+}
+
+#endif // runpath_H
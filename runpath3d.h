@@ -0,0 +1,9 @@
+/***** Autogenerated from runpath3d.in; changes will be overwritten *****/
+
+#ifndef runpath3d_H
+#define runpath3d_H
+namespace run {
+void nullPath3(vm::stack *);
+}
+
+#endif // runpath3d_H
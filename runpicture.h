@@ -0,0 +1,9 @@
+/***** Autogenerated from runpicture.in; changes will be overwritten *****/
+
+#ifndef runpicture_H
+#define runpicture_H
+namespace run {
+void newPicture(vm::stack *);
+}
+
+#endif // runpicture_H
@@ -0,0 +1,189 @@
+/*****
+ * sampler.cc
+ *
+ * A sampling profiler: a timer thread periodically counts a sample against
+ * what the main thread is doing, and the virtual machine attributes the
+ * samples to its current call stack at the next instruction.
+ *****/
+
+#include <chrono>
+#include <map>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "sampler.h"
+#include "program.h"
+#include "profiler.h"
+#include "vm.h"
+
+namespace vm {
+
+std::atomic<bool> samplesPending(false);
+
+namespace {
+
+std::atomic<bool> sampling(false);
+std::thread::id owner;
+std::thread *timer=NULL;
+std::atomic<bool> stopping(false);
+
+// Samples are counted by the timing phase of the main thread, with two more
+// slots for those taken outside any phase and during a collection.
+const int NOPHASE=timing::NUMPHASES;
+const int COLLECTING=NOPHASE+1;
+const int NUMSLOTS=COLLECTING+1;
+
+std::atomic<int> current(NOPHASE);
+std::atomic<bool> collecting(false);
+std::atomic<size_t> pending[NUMSLOTS];
+
+// The frame below which the samples of each slot are shown; those that run
+// bytecode and builtins are shown under their call stack alone.
+const char *slotName[]={"[translate]","[translate]","","[tex]","","[process]",
+                        "","","[gc]"};
+
+// The bookkeeping uses the standard allocator so that it is not collected.
+typedef std::map<std::string,size_t> stackmap;
+stackmap stacks;
+
+codeLabels labels;
+
+// Name a function by where it is defined.
+std::string label(lambda *func)
+{
+  const codeLabel& l=labels(func);
+  return l.name.empty() ? l.where : l.name+" at "+l.where;
+}
+
+// Name a builtin function by where it is called.
+std::string label(const inst *i)
+{
+  const codeLabel& l=labels(*i);
+  return l.where.empty() ? l.name+" builtin" : l.name+" builtin at "+l.where;
+}
+
+// Semicolons separate the frames of a collapsed stack.
+void push(std::string& stack, const std::string& frame)
+{
+  if(!stack.empty()) stack += ';';
+  size_t start=stack.size();
+  stack += frame;
+  for(size_t i=start; i < stack.size(); ++i)
+    if(stack[i] == ';') stack[i]=',';
+}
+
+void tick(size_t rate)
+{
+  std::chrono::steady_clock::duration period=
+    std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::nanoseconds(1000000000/rate));
+  std::chrono::steady_clock::time_point next=std::chrono::steady_clock::now();
+  while(!stopping) {
+    next += period;
+    std::this_thread::sleep_until(next);
+    int a=collecting ? COLLECTING : current.load();
+    pending[a].fetch_add(1,std::memory_order_relaxed);
+    samplesPending.store(true,std::memory_order_relaxed);
+  }
+}
+
+#if defined(USEGC) && GC_VERSION_MAJOR >= 8
+void GC_CALLBACK onCollection(GC_EventType event)
+{
+  if(event == GC_EVENT_START) collecting=true;
+  else if(event == GC_EVENT_END) collecting=false;
+}
+#endif
+
+}
+
+void beginSampling(size_t rate)
+{
+  if(sampling || rate == 0) return;
+  owner=std::this_thread::get_id();
+  for(int a=0; a < NUMSLOTS; ++a)
+    pending[a]=0;
+  stopping=false;
+  sampling=true;
+#if defined(USEGC) && GC_VERSION_MAJOR >= 8
+  GC_set_on_collection_event(onCollection);
+#endif
+  timer=new std::thread(tick,rate);
+}
+
+void endSampling(std::ostream& out)
+{
+  if(!sampling) return;
+  stopping=true;
+  timer->join();
+  delete timer;
+  timer=NULL;
+#if defined(USEGC) && GC_VERSION_MAJOR >= 8
+  GC_set_on_collection_event(0);
+#endif
+  takeSamples();
+  sampling=false;
+
+  for(stackmap::const_iterator p=stacks.begin(); p != stacks.end(); ++p)
+    out << p->first << " " << p->second << "\n";
+  out.flush();
+  stacks.clear();
+  labels.clear();
+}
+
+void takeSamples()
+{
+  if(!sampling || std::this_thread::get_id() != owner) return;
+  samplesPending.store(false,std::memory_order_relaxed);
+
+  size_t n[NUMSLOTS];
+  size_t total=0;
+  for(int a=0; a < NUMSLOTS; ++a)
+    total += n[a]=pending[a].exchange(0,std::memory_order_relaxed);
+  if(total == 0) return;
+
+  std::vector<const activation *> chain;
+  for(const activation *a=getActivation(); a; a=a->prev)
+    chain.push_back(a);
+
+  // Walk from the outermost function, showing the builtins that call back
+  // into compiled code.
+  std::string stack;
+  for(size_t k=chain.size(); k-- > 0;) {
+    const activation *a=chain[k];
+    if(k+1 < chain.size() && a->caller && a->caller->op == inst::builtin)
+      push(stack,label(a->caller));
+    push(stack,label(a->func));
+  }
+
+  // Charge the time since the last instruction to the builtin it called.
+  const inst *i=getInst();
+  if(i && i->op == inst::builtin && !(chain.size() && i == chain[0]->caller))
+    push(stack,label(i));
+
+  for(int a=0; a < NUMSLOTS; ++a) {
+    if(n[a] == 0) continue;
+    std::string s=stack;
+    if(*slotName[a]) push(s,slotName[a]);
+    if(s.empty()) s="<outside the virtual machine>";
+    stacks[s] += n[a];
+  }
+}
+
+int enterPhase(timing::phase p)
+{
+  if(!sampling.load(std::memory_order_relaxed) ||
+     std::this_thread::get_id() != owner) return -1;
+  return current.exchange(p);
+}
+
+void leavePhase(int saved)
+{
+  // Attribute the samples taken during the phase while its call stack is
+  // still current.
+  if(samplesPending) takeSamples();
+  current=saved;
+}
+
+} // namespace vm
@@ -0,0 +1,40 @@
+/*****
+ * sampler.h
+ *
+ * A sampling profiler: a timer thread periodically counts a sample against
+ * what the main thread is doing, and the virtual machine attributes the
+ * samples to its current call stack at the next instruction.
+ *****/
+
+#ifndef SAMPLER_H
+#define SAMPLER_H
+
+#include <atomic>
+#include <iostream>
+
+#include "timing.h"
+
+namespace vm {
+
+// Set by the timer thread when samples are waiting to be attributed.
+extern std::atomic<bool> samplesPending;
+
+// Start taking rate samples per second of the calling thread.
+void beginSampling(size_t rate);
+
+// Stop sampling and write the samples as collapsed stacks, one line per
+// distinct call stack, for use with flame graph tools.
+void endSampling(std::ostream& out);
+
+// Attribute the samples taken since the last call to the current call stack.
+void takeSamples();
+
+// If the calling thread is being sampled, show its samples under phase p,
+// set by a timing::timer, and return the phase to restore with leavePhase;
+// otherwise return -1.
+int enterPhase(timing::phase p);
+void leavePhase(int saved);
+
+} // namespace vm
+
+#endif
@@ -1289,6 +1289,12 @@ void initSettings() {
                             "Generate inline embedded image"));
   addOption(new boolSetting("compress", 0,
                             "Compress images in PDF output", true));
+  addOption(new boolSetting("nativepdf", 0,
+                            "Write PDF output directly when TeX is not needed",
+                            true));
+  addOption(new boolSetting("gsapi", 0,
+                            "Run Ghostscript in-process through libgs",
+                            false));
   addOption(new boolSetting("parseonly", 'p', "Parse file"));
   addOption(new boolSetting("translate", 's',
                             "Show translated virtual machine code"));
@@ -1333,7 +1339,23 @@ void initSettings() {
                                &compact));
   addOption(new divisorOption("divisor", 0, "n",
                               "Garbage collect using purge(divisor=n) [2]"));
+  addOption(new boolSetting("incremental", 0,
+                            "Collect garbage incrementally"));
+  addOption(new IntSetting("heapsize", 0, "n",
+                           "Preallocate a heap of n megabytes", 0));
+  addOption(new IntSetting("maxheapsize", 0, "n",
+                           "Limit the heap to n megabytes (0=unlimited)", 0));
 #endif
+  addOption(new boolSetting("profilealloc", 0,
+                            "Report allocations by instruction and source position"));
+  addOption(new stringSetting("profile", 0, "file",
+                              "Write sampled call stacks to file for flame graphs",
+                              ""));
+  addOption(new IntSetting("profilerate", 0, "n",
+                           "Take n profile samples per second", 1000));
+  addOption(new stringSetting("timing", 0, "format",
+                              "Report time and counts by phase as a table or json",
+                              ""));
 
   addOption(new stringSetting("prompt", 0,"string","Prompt","> "));
   addOption(new stringSetting("prompt2", 0,"string",
@@ -1346,6 +1368,9 @@ void initSettings() {
 
   addOption(new boolSetting("wait", 0,
                             "Wait for child processes to finish before exiting"));
+  addOption(new IntSetting("jobs", 0, "n",
+                           "Process up to n shipouts in the background",
+                           0));
   addOption(new IntSetting("inpipe", 0, "n","",-1));
   addOption(new IntSetting("outpipe", 0, "n","",-1));
   addOption(new boolSetting("exitonEOF", 0, "Exit interactive mode on EOF",
@@ -1796,6 +1821,12 @@ void setOptions(int argc, char *argv[])
 
 #ifdef USEGC
   if(verbose == 0 && !getSetting<bool>("debug")) GC_set_warn_proc(no_GCwarn);
+  if(getSetting<bool>("incremental")) GC_enable_incremental();
+  Int heapsize=getSetting<Int>("heapsize");
+  if(heapsize > 0 && ((size_t) heapsize << 20) > GC_get_heap_size())
+    GC_expand_hp(((size_t) heapsize << 20)-GC_get_heap_size());
+  Int maxheapsize=getSetting<Int>("maxheapsize");
+  GC_set_max_heap_size(maxheapsize > 0 ? (GC_word) maxheapsize << 20 : 0);
 #endif
 
   if(setlocale (LC_ALL, "") == NULL && getSetting<bool>("debug"))
@@ -17,6 +17,7 @@
 #include "process.h"
 
 #include "profiler.h"
+#include "sampler.h"
 
 #ifdef DEBUG_STACK
 #include <iostream>
@@ -38,7 +39,25 @@ mem::list<bpinfo> bplist;
 
 namespace {
 position curPos = nullPos;
+const inst *curInst = NULL;
+const activation *curActivation = NULL;
 const program::label nulllabel;
+
+// Record the function being run, and restore the current instruction of the
+// caller when it returns.
+struct activator {
+  activation a;
+  activator(lambda *l) {
+    a.func=l;
+    a.caller=curInst;
+    a.prev=curActivation;
+    curActivation=&a;
+  }
+  ~activator() {
+    curInst=a.caller;
+    curActivation=a.prev;
+  }
+};
 }
 
 inline stack::vars_t base_frame(
@@ -160,9 +179,6 @@ void stack::marshall(size_t args, stack::vars_t vars)
 #ifndef DEBUG_FRAME
 #warning "profiler needs DEBUG_FRAME for function names"
 #endif
-#ifndef DEBUG_BLTIN
-#warning "profiler needs DEBUG_BLTIN for builtin function names"
-#endif
 
 profiler prof;
 
@@ -270,6 +286,8 @@ void stack::debug()
 
 void stack::runWithOrWithoutClosure(lambda *l, vars_t vars, vars_t parent)
 {
+  activator saver(l);
+
   // The size of the frame (when running without closure).
   size_t frameSize = l->parentIndex;
 
@@ -342,7 +360,12 @@ void stack::runWithOrWithoutClosure(lambda *l, vars_t vars, vars_t parent)
   try {
     for (;;) {
       const inst &i = *ip;
+
+      // Attribute pending samples to the previous instruction.
+      if(samplesPending.load(std::memory_order_relaxed)) takeSamples();
+
       curPos = i.pos;
+      curInst = &i;
 
       if(curPos.filename() == fileName)
         topPos=curPos;
@@ -641,6 +664,14 @@ position getPos() {
   return curPos;
 }
 
+const inst *getInst() {
+  return curInst;
+}
+
+const activation *getActivation() {
+  return curActivation;
+}
+
 void errornothrow(const char* message)
 {
   em.error(curPos);
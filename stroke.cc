@@ -0,0 +1,385 @@
+/*****
+ * stroke.cc
+ *
+ * Compute the outline of the region covered by stroking a path with a pen.
+ *
+ * The path is flattened and dashed, and each dash is replaced by the
+ * boundary of the union of the rectangles swept by its segments, together
+ * with the wedges that fill the outer side of each join and the caps at its
+ * ends. On the inner side of a join the offset segments are cut where they
+ * cross, looking back along the offset as far as a turn of radius below the
+ * half width can reach. Where no crossing is found, as where the pen is wider
+ * than the features of the path, the boundary instead passes through the
+ * vertex itself. Since every piece is traversed counterclockwise, the winding
+ * number of such an outline is still positive exactly on the stroked region,
+ * and its union is taken to make it simple.
+ *****/
+
+#include <cmath>
+#include <vector>
+
+#include "stroke.h"
+#include "drawpath.h"
+#include "region.h"
+
+using vm::read;
+
+namespace camp {
+
+namespace {
+
+typedef std::vector<pair> polyline;
+
+const pair I(0,1);
+
+// A dash, and the direction of the path where it lies, which is used to
+// orient the caps of a dash of zero length.
+struct dash {
+  polyline z;
+  pair dir;
+};
+
+// One side of the outline of a dash, with the index of the first point that
+// each vertex of the dash added to it.
+struct side {
+  polyline z;
+  std::vector<size_t> start;
+  size_t floor;         // Joins never cut the offset before this point.
+  side() : floor(0) {}
+};
+
+// If the segments from a to b and from c to e cross, set x to the crossing.
+bool crossing(pair& x, const pair& a, const pair& b, const pair& c,
+              const pair& e)
+{
+  pair u=b-a;
+  pair w=e-c;
+  double denom=cross(u,w);
+  if(denom == 0.0) return false;
+  pair r=c-a;
+  double s=cross(r,w)/denom;
+  double t=cross(r,u)/denom;
+  if(s < 0.0 || s > 1.0 || t < 0.0 || t > 1.0) return false;
+  x=a+s*u;
+  return true;
+}
+
+// Remove consecutive duplicate vertices, including, for a cyclic polyline,
+// a final vertex equal to the first.
+void unique(polyline& z, bool cycles)
+{
+  size_t m=z.size();
+  if(m == 0) return;
+  size_t k=1;
+  for(size_t i=1; i < m; ++i)
+    if(z[i] != z[k-1]) z[k++]=z[i];
+  if(cycles)
+    while(k > 1 && z[k-1] == z[0]) --k;
+  z.resize(k);
+}
+
+// Split the polyline z into the dashes of the PostScript pattern pat
+// starting at the given offset.
+void dashes(std::vector<dash>& D, const polyline& z, bool cycles,
+            const std::vector<double>& pat, double offset)
+{
+  size_t n=pat.size();
+  double period=0.0;
+  for(size_t i=0; i < n; ++i)
+    period += pat[i];
+
+  size_t k=0;
+  double left=fmod(offset,period);
+  if(left < 0) left += period;
+  while(left >= pat[k]) {
+    left -= pat[k];
+    k=(k+1) % n;
+  }
+  left=pat[k]-left;
+  bool on=k % 2 == 0;
+  bool first=on;
+
+  size_t m=z.size();
+  size_t segments=cycles ? m : m-1;
+  dash d;
+  if(on) d.z.push_back(z[0]);
+  for(size_t i=0; i < segments; ++i) {
+    const pair& a=z[i];
+    const pair& b=z[i+1 < m ? i+1 : 0];
+    pair v=b-a;
+    double len=v.length();
+    pair dir=v/len;
+    double s=0.0;
+    while(len-s > left) {
+      s += left;
+      pair c=a+dir*s;
+      if(on) {
+        d.z.push_back(c);
+        d.dir=dir;
+        D.push_back(d);
+        d.z.clear();
+      } else d.z.push_back(c);
+      on=!on;
+      k=(k+1) % n;
+      left=pat[k];
+    }
+    left -= len-s;
+    if(on) {
+      d.z.push_back(b);
+      d.dir=dir;
+    }
+  }
+  if(on && d.z.size() > 0) {
+    // On a cyclic path, join a dash that runs through the starting point.
+    if(cycles && first && D.size() > 0) {
+      d.z.insert(d.z.end(),D[0].z.begin(),D[0].z.end());
+      D[0].z.swap(d.z);
+    } else D.push_back(d);
+  }
+}
+
+class stroker {
+  mem::vector<path>& P;
+  double h;             // Half of the line width.
+  Int cap, join;
+  double miterlimit;
+  double tolerance;
+  double dtheta;        // The angle subtended by each chord of an arc.
+  bool simple;          // Were all inner joins of the dash cut?
+
+  // Append the points of the arc of radius h centered at c from angle a
+  // through the given sweep, excluding both endpoints.
+  void arc(polyline& w, const pair& c, double a, double sweep) {
+    Int m=(Int) ceil(fabs(sweep)/dtheta);
+    double da=sweep/m;
+    for(Int j=1; j < m; ++j)
+      w.push_back(c+h*expi(a+j*da));
+  }
+
+  // Fill the outer side of the join at v, turning through the angle theta,
+  // from the offset v+u1*h to v+u2*h.
+  void outer(polyline& w, const pair& v, const pair& u1, const pair& u2,
+             double theta) {
+    w.push_back(v+u1*h);
+    if(join == 1)
+      arc(w,v,angle(u1),theta);
+    else if(join == 0) {
+      double c=cos(0.5*theta);
+      if(c*miterlimit >= 1.0)
+        w.push_back(v+unit(u1+u2)*(h/c));
+    }
+    w.push_back(v+u2*h);
+  }
+
+  // The arclength along the dash to the vertex added at each step, and the
+  // first step within reach of the current one.
+  std::vector<double> S;
+  size_t reach;
+
+  // Join the offset segment of s that ends at b1 to the next one, from a2 to
+  // b2, on the inner side of the vertex v added at step k. The next segment
+  // cuts the offset at its last crossing within reach; if it is the first
+  // segment of the offset (on the last join of a cyclic dash), its start is
+  // moved there instead.
+  void inner(side& s, size_t k, const pair& b1, const pair& v, const pair& a2,
+             const pair& b2, bool wrap) {
+    polyline& w=s.z;
+    while(S[k]-S[reach] > PI*h) ++reach;
+    size_t lo=reach > 0 ? s.start[reach]-1 : 0;
+    if(lo < s.floor) lo=s.floor;
+    if(wrap && lo < 1) lo=1;
+    pair x;
+    pair next=b1;
+    for(size_t j=w.size(); j > lo; --j) {
+      if(crossing(x,w[j-1],next,a2,b2)) {
+        w.resize(j);
+        if(wrap) w[0]=x;
+        else w.push_back(x);
+        return;
+      }
+      next=w[j-1];
+    }
+    w.push_back(b1);
+    w.push_back(v);
+    if(!wrap) w.push_back(a2);
+    s.floor=w.size()-1;
+    simple=false;
+  }
+
+  // Append to the right and left offsets R and L the join added at step k
+  // at the vertex v, from the unit direction d1 to d2; the segment leaving
+  // v ends at next.
+  void vertex(side& R, side& L, size_t k, const pair& v, const pair& d1,
+              const pair& d2, const pair& next, bool wrap=false) {
+    R.start.push_back(R.z.size());
+    L.start.push_back(L.z.size());
+    pair n1=d1*I;
+    pair n2=d2*I;
+    double cross=d1.getx()*d2.gety()-d1.gety()*d2.getx();
+    double dot=d1.getx()*d2.getx()+d1.gety()*d2.gety();
+    if(cross == 0.0 && dot > 0.0) {
+      if(!wrap) {
+        R.z.push_back(v-n1*h);
+        L.z.push_back(v+n1*h);
+      }
+      return;
+    }
+    double theta=atan2(cross,dot);
+    if(cross >= 0.0) {
+      outer(R.z,v,-n1,-n2,theta);
+      inner(L,k,v+n1*h,v,v+n2*h,next+n2*h,wrap);
+    } else {
+      outer(L.z,v,n1,n2,theta);
+      inner(R,k,v-n1*h,v,v-n2*h,next-n2*h,wrap);
+    }
+    if(wrap) {
+      // The outer side ends where it started.
+      side& o=cross >= 0.0 ? R : L;
+      if(o.z.size() > 1 && o.z.back() == o.z[0]) o.z.pop_back();
+    }
+  }
+
+  // Replace the pieces of the outline of a dash, from P[first] on, by the
+  // boundary of their union if they may overlap.
+  void unite(size_t first) {
+    if(simple) return;
+    mem::vector<path> pieces;
+    pieces.assign(P.begin()+first,P.end());
+    P.resize(first);
+    std::vector<const path *> p(pieces.size());
+    for(size_t i=0; i < pieces.size(); ++i)
+      p[i]=&pieces[i];
+    combine(P,p,std::vector<const path *>(),UNION,pen(ZEROWINDING),tolerance);
+  }
+
+  // Append to w the cap at the end v of a dash leaving in direction d,
+  // from v-n*h to v+n*h, excluding both endpoints.
+  void endcap(polyline& w, const pair& v, const pair& d) {
+    pair n=d*I;
+    if(cap == 1)
+      arc(w,v,angle(-n),PI);
+    else if(cap == 2) {
+      w.push_back(v+(d-n)*h);
+      w.push_back(v+(d+n)*h);
+    }
+  }
+
+public:
+  stroker(mem::vector<path>& P, double width, Int cap, Int join,
+          double miterlimit, double tolerance) :
+    P(P), h(0.5*width), cap(cap), join(join), miterlimit(miterlimit),
+    tolerance(tolerance) {
+    dtheta=tolerance < h ? 2.0*acos(1.0-tolerance/h) : PI;
+    if(dtheta > 0.25*PI) dtheta=0.25*PI;
+  }
+
+  void stroke(const polyline& z, bool cycles, const pair& dir) {
+    size_t m=z.size();
+    polyline w;
+
+    if(m == 1) {
+      if(cap == 0) return;
+      const pair& v=z[0];
+      pair n=dir*I;
+      w.push_back(v-n*h);
+      endcap(w,v,dir);
+      w.push_back(v+n*h);
+      endcap(w,v,-dir);
+      P.push_back(straightpath(w,true));
+      return;
+    }
+
+    size_t segments=cycles ? m : m-1;
+    std::vector<pair> d(segments);
+    S.resize(segments+1);
+    S[0]=0.0;
+    for(size_t i=0; i < segments; ++i) {
+      pair v=z[i+1 < m ? i+1 : 0]-z[i];
+      S[i+1]=S[i]+v.length();
+      d[i]=unit(v);
+    }
+    reach=0;
+    simple=true;
+    size_t first=P.size();
+
+    // Step k adds the vertex z[k], and, on a cyclic dash, step m adds z[0]
+    // again to join the last segment to the first.
+    side R,L;
+    pair n=d[0]*I;
+    R.start.push_back(0);
+    L.start.push_back(0);
+    R.z.push_back(z[0]-n*h);
+    L.z.push_back(z[0]+n*h);
+    if(cycles) {
+      for(size_t i=1; i < m; ++i)
+        vertex(R,L,i,z[i],d[i-1],d[i],z[i+1 < m ? i+1 : 0]);
+      vertex(R,L,m,z[0],d[m-1],d[0],z[1],true);
+      P.push_back(straightpath(R.z,true));
+      w.assign(L.z.rbegin(),L.z.rend());
+      P.push_back(straightpath(w,true));
+      unite(first);
+      return;
+    }
+
+    for(size_t i=1; i+1 < m; ++i)
+      vertex(R,L,i,z[i],d[i-1],d[i],z[i+1]);
+    n=d[m-2]*I;
+    R.z.push_back(z[m-1]-n*h);
+    L.z.push_back(z[m-1]+n*h);
+
+    w.swap(R.z);
+    endcap(w,z[m-1],d[m-2]);
+    w.insert(w.end(),L.z.rbegin(),L.z.rend());
+    endcap(w,z[0],-d[0]);
+    P.push_back(straightpath(w,true));
+    unite(first);
+  }
+};
+
+}
+
+void strokepath(mem::vector<path>& P, const path& g, pen p, double tolerance)
+{
+  double width=p.width();
+  if(g.size() == 0 || width <= 0) return;
+  if(!(tolerance > 0))
+    reportError("stroking tolerance must be positive");
+
+  bool cycles=g.cyclic();
+  polyline z;
+  g.flatten(z,tolerance);
+  unique(z,cycles);
+  if(z.size() == 1) cycles=false;
+
+  stroker s(P,width,p.cap(),p.join(),p.miter(),tolerance);
+
+  const LineType *linetype=p.linetype();
+  size_t n=linetype->pattern.size();
+  if(n > 0 && z.size() > 1) {
+    // Dash exactly as drawing does.
+    pen q=adjustdash(p,g.arclength(),cycles);
+    linetype=q.linetype();
+    std::vector<double> pat(n);
+    double period=0.0;
+    for(size_t i=0; i < n; ++i) {
+      double v=read<double>(linetype->pattern,i);
+      if(v < 0)
+        reportError("dash pattern entries must be nonnegative");
+      period += pat[i]=v;
+    }
+    if(period > 0) {
+      if(n % 2 == 1) pat.insert(pat.end(),pat.begin(),pat.end());
+      std::vector<dash> D;
+      dashes(D,z,cycles,pat,linetype->offset);
+      for(size_t i=0; i < D.size(); ++i) {
+        unique(D[i].z,false);
+        s.stroke(D[i].z,false,D[i].dir);
+      }
+      return;
+    }
+  }
+
+  s.stroke(z,cycles,pair(1,0));
+}
+
+}
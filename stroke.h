@@ -0,0 +1,23 @@
+/*****
+ * stroke.h
+ *
+ * Compute the outline of the region covered by stroking a path with a pen.
+ *****/
+
+#ifndef STROKE_H
+#define STROKE_H
+
+#include "path.h"
+#include "pen.h"
+
+namespace camp {
+
+// Append to P cyclic piecewise straight paths whose union, filled with the
+// nonzero winding rule, is the region covered when g is drawn with the line
+// width, cap, join, miter limit, and dash pattern of p. Curved segments and
+// round caps and joins are approximated to within the given tolerance.
+void strokepath(mem::vector<path>& P, const path& g, pen p, double tolerance);
+
+}
+
+#endif
@@ -10,6 +10,7 @@
 
 #include "texfile.h"
 #include "errormsg.h"
+#include "timing.h"
 
 using std::ofstream;
 using settings::getSetting;
@@ -39,6 +40,7 @@ texfile::texfile(const string& texname, const bbox& box, bool pipe)
 texfile::~texfile()
 {
   if(out) {
+    timing::wrote(*out);
     delete out;
     out=NULL;
   }
@@ -0,0 +1,140 @@
+/*****
+ * timing.cc
+ *
+ * Time spent in each phase of a run and counts of its costly operations,
+ * reported by the -timing option.
+ *****/
+
+#include <chrono>
+#include <iomanip>
+
+#include "timing.h"
+#include "sampler.h"
+
+namespace timing {
+
+std::atomic<bool> enabled(false);
+std::atomic<size_t> counts[NUMCOUNTERS];
+
+namespace {
+
+typedef std::chrono::steady_clock steady;
+
+const int NOPHASE=NUMPHASES;
+
+const char *phaseName[]={"parse","translate","execute","labels","output",
+                         "external","render"};
+
+const char *counterName[]={"tex_round_trips","gs_calls","processes",
+                           "shipouts","files","bytes_written","triangles"};
+
+std::atomic<long long> nanoseconds[NUMPHASES];
+std::atomic<size_t> calls[NUMPHASES];
+
+steady::time_point start;
+
+// Each thread charges its time to its innermost phase, if any.
+thread_local int current=NOPHASE;
+thread_local steady::time_point last;
+
+void charge(steady::time_point now)
+{
+  if(current != NOPHASE)
+    nanoseconds[current].fetch_add(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(now-last).count(),
+      std::memory_order_relaxed);
+  last=now;
+}
+
+double seconds(long long ns)
+{
+  return ns*1e-9;
+}
+
+}
+
+void begin()
+{
+  for(size_t p=0; p < NUMPHASES; ++p) {
+    nanoseconds[p]=0;
+    calls[p]=0;
+  }
+  for(size_t c=0; c < NUMCOUNTERS; ++c)
+    counts[c]=0;
+  start=steady::now();
+  enabled=true;
+}
+
+void report(std::ostream& out, bool json)
+{
+  if(!enabled) return;
+  enabled=false;
+
+  long long total=std::chrono::duration_cast<std::chrono::nanoseconds>(
+    steady::now()-start).count();
+
+  // The render thread runs alongside the others, so the phases may add up
+  // to more than the elapsed time.
+  long long other=total;
+  for(size_t p=0; p < NUMPHASES; ++p)
+    other -= nanoseconds[p];
+  if(other < 0) other=0;
+
+  std::ios::fmtflags flags=out.flags();
+  std::streamsize precision=out.precision();
+  out << std::fixed << std::setprecision(6);
+
+  if(json) {
+    out << "{\"total\":" << seconds(total) << ",\"phases\":{";
+    for(size_t p=0; p < NUMPHASES; ++p)
+      out << "\"" << phaseName[p] << "\":{\"seconds\":"
+          << seconds(nanoseconds[p]) << ",\"calls\":" << calls[p] << "},";
+    out << "\"other\":{\"seconds\":" << seconds(other) << "}},\"counters\":{";
+    for(size_t c=0; c < NUMCOUNTERS; ++c)
+      out << (c ? "," : "") << "\"" << counterName[c] << "\":" << counts[c];
+    out << "}}" << std::endl;
+  } else {
+    out << std::left << std::setw(16) << "phase" << std::right
+        << std::setw(12) << "seconds" << std::setw(10) << "calls" << "\n";
+    for(size_t p=0; p < NUMPHASES; ++p)
+      out << std::left << std::setw(16) << phaseName[p] << std::right
+          << std::setw(12) << seconds(nanoseconds[p])
+          << std::setw(10) << calls[p] << "\n";
+    out << std::left << std::setw(16) << "other" << std::right
+        << std::setw(12) << seconds(other) << "\n"
+        << std::left << std::setw(16) << "total" << std::right
+        << std::setw(12) << seconds(total) << "\n\n";
+    out << std::left << std::setw(16) << "counter" << std::right
+        << std::setw(12) << "count" << "\n";
+    for(size_t c=0; c < NUMCOUNTERS; ++c)
+      out << std::left << std::setw(16) << counterName[c] << std::right
+          << std::setw(12) << counts[c] << "\n";
+    out.flush();
+  }
+
+  out.flags(flags);
+  out.precision(precision);
+}
+
+timer::timer(phase p)
+  : active(enabled.load(std::memory_order_relaxed)), saved(NOPHASE),
+    sampled(vm::enterPhase(p))
+{
+  if(active) {
+    charge(steady::now());
+    saved=current;
+    current=p;
+    calls[p].fetch_add(1,std::memory_order_relaxed);
+  }
+}
+
+timer::~timer()
+{
+  if(sampled >= 0) vm::leavePhase(sampled);
+  if(active) {
+    charge(steady::now());
+    current=saved;
+  }
+}
+
+} // namespace timing
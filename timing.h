@@ -0,0 +1,65 @@
+/*****
+ * timing.h
+ *
+ * Time spent in each phase of a run and counts of its costly operations,
+ * reported by the -timing option.
+ *****/
+
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <atomic>
+#include <iostream>
+
+namespace timing {
+
+enum phase {PARSE, TRANSLATE, EXECUTE, LABELS, OUTPUT, EXTERNAL, RENDER,
+            NUMPHASES};
+
+enum counter {TEXROUNDTRIPS, GSCALLS, PROCESSES, SHIPOUTS, FILES, BYTES,
+              TRIANGLES, NUMCOUNTERS};
+
+extern std::atomic<bool> enabled;
+extern std::atomic<size_t> counts[NUMCOUNTERS];
+
+// Start timing the run.
+void begin();
+
+// Write the time spent in each phase and the counters, as a table or,
+// if json is true, as a JSON object.
+void report(std::ostream& out, bool json);
+
+inline void count(counter c, size_t n=1)
+{
+  if(enabled.load(std::memory_order_relaxed))
+    counts[c].fetch_add(n,std::memory_order_relaxed);
+}
+
+// Count a file, and the bytes written to it through out so far.
+inline void wrote(std::ostream& out)
+{
+  if(enabled.load(std::memory_order_relaxed)) {
+    std::streamoff n=out.tellp();
+    if(n >= 0) {
+      count(FILES);
+      count(BYTES,(size_t) n);
+    }
+  }
+}
+
+// Charge the time the calling thread spends while this object exists to
+// phase p, and show its samples under p if it is the thread being sampled
+// (see sampler.h). Timers nest: the time of an inner timer is not charged to
+// the phase of an outer one.
+class timer {
+  bool active;
+  int saved;
+  int sampled;          // The phase to restore in the sampler, or -1.
+public:
+  timer(phase p);
+  ~timer();
+};
+
+} // namespace timing
+
+#endif
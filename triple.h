@@ -317,13 +317,13 @@ public:
 
   friend ostream& operator << (ostream& out, const triple& v)
   {
-    out << "(" << v.x << "," << v.y << "," << v.z << ")";
+    realbuffer(out) << '(' << v.x << ',' << v.y << ',' << v.z << ')';
     return out;
   }
 
   friend jsofstream& operator << (jsofstream& out, const triple& v)
   {
-    out << "[" << v.x << "," << v.y << "," << v.z << "]";
+    realbuffer(out) << '[' << v.x << ',' << v.y << ',' << v.z << ']';
     return out;
   }
 
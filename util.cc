@@ -31,6 +31,7 @@
 #include "camperror.h"
 #include "interact.h"
 #include "locate.h"
+#include "timing.h"
 
 using namespace settings;
 using camp::reportError;
@@ -307,6 +308,8 @@ int System(const mem::vector<string> &command, int quiet, bool wait,
   }
 
   if(ppid) *ppid=pid;
+  timing::count(timing::PROCESSES);
+  timing::timer timer(timing::EXTERNAL);
   for(;;) {
     if(waitpid(pid, &status, wait ? 0 : WNOHANG) == -1) {
       if(errno == ECHILD) return 0;
@@ -12,24 +12,46 @@
 
 namespace vm {
 
-struct lambda; class stack;
+struct lambda; class stack; struct inst;
 typedef void (*bltin)(stack *s);
 
-#ifdef DEBUG_BLTIN
 // This associates names to bltin functions, so that the output of 'asy -s'
-// can print the names of the bltin functions that appear in the bytecode.
+// and the profilers can print the names of the bltin functions that appear in
+// the bytecode.  An unregistered function has an empty name.
 void registerBltin(bltin b, string s);
 string lookupBltin(bltin b);
 
 #define REGISTER_BLTIN(b, s)                    \
   registerBltin((b), (s))
-#else
-#define REGISTER_BLTIN(b, s)
-#endif
+
+// A builtin that returns a newly allocated array may register a variant
+// that instead stores its result in one of its array arguments, for use
+// when the translator knows that argument to be an unreferenced temporary.
+// The depth is the position of that argument on the stack (0 for the top).
+void registerInPlace(bltin b, bltin variant, size_t depth);
+
+// Returns the registered variant of b for the given depth, or 0 if none.
+bltin lookupInPlace(bltin b, size_t depth);
+
+// Returns true if b always returns a newly allocated array.
+bool returnsTemporary(bltin b);
 
 void run(lambda *l);
 position getPos();
 
+// The instruction being executed, or NULL outside of the virtual machine.
+const inst *getInst();
+
+// A function being run, with the instruction of its caller that called it.
+struct activation {
+  lambda *func;
+  const inst *caller;
+  const activation *prev;
+};
+
+// The innermost function being run, or NULL outside of the virtual machine.
+const activation *getActivation();
+
 void errornothrow(const char* message);
 void error(const char* message);
 void error(const ostringstream& message);